@@ -1,6 +1,7 @@
 #pragma once
 #include <stddef.h>
 #include <stdint.h>
+#include <memory.h>
 #include <gmp.h>
 #include <initializer_list>
 #include <vector>
@@ -24,11 +25,22 @@ public:
         // __IntegerType must be a integer type, i.e. char, int, unsigned long...
         static_assert(std::is_integral<__IntegerType>::value);
 
+#if defined(__MPIR_VERSION)
         if constexpr (std::is_signed<__IntegerType>::value) {
             mpz_init_set_sx(m_Value, SmallInteger);
         } else {
             mpz_init_set_ux(m_Value, SmallInteger);
         }
+#else
+        // GMP takes long only, which is 64-bit on Linux x64
+        static_assert(sizeof(__IntegerType) <= sizeof(long));
+
+        if constexpr (std::is_signed<__IntegerType>::value) {
+            mpz_init_set_si(m_Value, SmallInteger);
+        } else {
+            mpz_init_set_ui(m_Value, SmallInteger);
+        }
+#endif
     }
 
     BigInteger(bool IsNegative, const void* lpBytes, size_t cbBytes, BigIntegerEndian Endian) noexcept : m_Value{} {
@@ -84,7 +96,7 @@ public:
     BigInteger& operator=(BigInteger&& Other) noexcept {
         if (this != std::addressof(Other)) {
             mpz_swap(m_Value, Other.m_Value);
-            mpz_set_ux(Other.m_Value, 0);
+            mpz_set_ui(Other.m_Value, 0);
         }
 
         return *this;
@@ -95,11 +107,21 @@ public:
         // __IntegerType must be a integer type, i.e. char, int, unsigned long...
         static_assert(std::is_integral<__IntegerType>::value);
 
+#if defined(__MPIR_VERSION)
         if constexpr (std::is_signed<__IntegerType>::value) {
             mpz_set_sx(m_Value, SmallInteger);
         } else {
             mpz_set_ux(m_Value, SmallInteger);
         }
+#else
+        static_assert(sizeof(__IntegerType) <= sizeof(long));
+
+        if constexpr (std::is_signed<__IntegerType>::value) {
+            mpz_set_si(m_Value, SmallInteger);
+        } else {
+            mpz_set_ui(m_Value, SmallInteger);
+        }
+#endif
 
         return *this;
     }
@@ -153,6 +175,11 @@ public:
         return Result;
     }
 
+    BigInteger& Negate() noexcept {
+        mpz_neg(m_Value, m_Value);
+        return *this;
+    }
+
     [[nodiscard]]
     BigInteger operator+(const BigInteger& Other) const noexcept {
         BigInteger Result;
@@ -381,6 +408,29 @@ public:
         mpz_setbit(m_Value, i);
     }
 
+    // The value as __IntegerType, which it must fit in.
+    template<typename __IntegerType>
+    [[nodiscard]]
+    __IntegerType ToInteger() const noexcept {
+        static_assert(std::is_integral<__IntegerType>::value);
+
+#if defined(__MPIR_VERSION)
+        if constexpr (std::is_signed<__IntegerType>::value) {
+            return static_cast<__IntegerType>(mpz_get_sx(m_Value));
+        } else {
+            return static_cast<__IntegerType>(mpz_get_ux(m_Value));
+        }
+#else
+        static_assert(sizeof(__IntegerType) <= sizeof(long));
+
+        if constexpr (std::is_signed<__IntegerType>::value) {
+            return static_cast<__IntegerType>(mpz_get_si(m_Value));
+        } else {
+            return static_cast<__IntegerType>(mpz_get_ui(m_Value));
+        }
+#endif
+    }
+
     [[nodiscard]]
     std::string ToString(size_t Base, bool LowerCase = false) const {
         if (2 <= Base && Base <= 10 + 26) {
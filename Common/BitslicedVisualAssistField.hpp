@@ -0,0 +1,232 @@
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+#include <memory.h>
+#include <stdexcept>
+#include "Intrinsics.hpp"
+#include "VisualAssistFieldTraits.hpp"
+#include "VisualAssistFieldLanes.hpp"
+
+// A batch of GF(2^113) elements in bit-sliced layout:
+//     slice i holds bit i of every element in the batch, one element per bit of `__Lanes::VectorType`.
+// So a batch has 128, 256 or 512 elements for SSE2, AVX2 or AVX-512 lanes respectively.
+//
+// Squaring is just a renumbering of slices, and multiplication is the Ning-Yin formula
+//     c_j = sum(a_(j + i) & (b_(j + T0[i]) + b_(j + T1[i])))    where indexes are taken modulo 113
+// evaluated with AND and XOR only. No operation depends on the values of elements, so all of them run in constant time.
+template<typename __Lanes = VisualAssistFieldLanesSse2>
+class BitslicedVisualAssistField {
+public:
+
+    using ElementType = VisualAssistFieldTraits::ElementType;
+    using VectorType = typename __Lanes::VectorType;
+
+    static constexpr size_t BinaryBitSizeValue = VisualAssistFieldTraits::BinaryBitSizeValue;
+    static constexpr size_t BatchSizeValue = sizeof(VectorType) * 8;
+
+private:
+
+    // 16 elements are transposed at a time, so every slice is made up of 16-bit chunks.
+    static constexpr size_t ChunkCountValue = BatchSizeValue / 16;
+
+    alignas(64) uint16_t m_Slices[BinaryBitSizeValue][ChunkCountValue];
+
+    // Uninitialized.
+    BitslicedVisualAssistField(std::nullptr_t) noexcept {}
+
+    [[nodiscard]]
+    VectorType LoadSlice(size_t i) const noexcept {
+        return __Lanes::Load(reinterpret_cast<const __m128i*>(m_Slices[i]));
+    }
+
+    void StoreSlice(size_t i, const VectorType& Slice) noexcept {
+        __Lanes::Store(reinterpret_cast<__m128i*>(m_Slices[i]), Slice);
+    }
+
+    // Column c of the result is byte c of every input element, i.e. a 16 x 16 byte matrix transpose.
+    // Each round rotates the 8-bit address (row, column) of every byte left by one, so 4 rounds swap row and column.
+    static void TransposeBytes(__m128i Rows[16]) noexcept {
+        for (size_t Round = 0; Round < 4; ++Round) {
+            __m128i t[16];
+
+            for (size_t i = 0; i < 8; ++i) {
+                t[2 * i] = _mm_unpacklo_epi8(Rows[i], Rows[i + 8]);
+                t[2 * i + 1] = _mm_unpackhi_epi8(Rows[i], Rows[i + 8]);
+            }
+
+            for (size_t i = 0; i < 16; ++i) {
+                Rows[i] = t[i];
+            }
+        }
+    }
+
+    // Result = A ^ (2 ^ k), i.e. bit j goes to bit j + k
+    static void RotateSlices(BitslicedVisualAssistField& Result, const BitslicedVisualAssistField& A, size_t k) noexcept {
+        for (size_t j = 0; j < BinaryBitSizeValue; ++j) {
+            memcpy(Result.m_Slices[(j + k) % BinaryBitSizeValue], A.m_Slices[j], sizeof(A.m_Slices[j]));
+        }
+    }
+
+    // Result = A * B, `Result` must not be the same object as `A` or `B`.
+    static void MultiplySlices(BitslicedVisualAssistField& Result, const BitslicedVisualAssistField& A, const BitslicedVisualAssistField& B) noexcept {
+        // slices repeated twice, so that indexes never wrap around
+        VectorType A2[2 * BinaryBitSizeValue];
+        VectorType B2[2 * BinaryBitSizeValue];
+
+        for (size_t i = 0; i < BinaryBitSizeValue; ++i) {
+            A2[i] = A2[i + BinaryBitSizeValue] = A.LoadSlice(i);
+            B2[i] = B2[i + BinaryBitSizeValue] = B.LoadSlice(i);
+        }
+
+        for (size_t j = 0; j < BinaryBitSizeValue; ++j) {
+            VectorType c = __Lanes::And(A2[j], B2[j + VisualAssistFieldTraits::T0[0]]);
+
+            for (size_t i = 1; i < BinaryBitSizeValue; ++i) {
+                c = __Lanes::Xor(
+                    c,
+                    __Lanes::And(
+                        A2[j + i],
+                        __Lanes::Xor(B2[j + VisualAssistFieldTraits::T0[i]], B2[j + VisualAssistFieldTraits::T1[i]])
+                    )
+                );
+            }
+
+            Result.StoreSlice(j, c);
+        }
+    }
+
+public:
+
+    // All elements are zero.
+    BitslicedVisualAssistField() noexcept : m_Slices{} {}
+
+    BitslicedVisualAssistField(const ElementType Elements[], size_t Count) {
+        Load(Elements, Count);
+    }
+
+    // Elements after `Count` are set to zero.
+    BitslicedVisualAssistField& Load(const ElementType Elements[], size_t Count) {
+        if (Count > BatchSizeValue) {
+            throw std::length_error("Too many elements for one batch.");
+        }
+
+        for (size_t Chunk = 0; Chunk < ChunkCountValue; ++Chunk) {
+            __m128i Columns[16];
+
+            for (size_t k = 0; k < 16; ++k) {
+                size_t i = 16 * Chunk + k;
+                Columns[k] = i < Count ? _mm_loadu_si128(&Elements[i]) : _mm_setzero_si128();
+            }
+
+            TransposeBytes(Columns);
+
+            // bit s of byte c -> slice 8 * c + s
+            for (size_t i = 0; i < BinaryBitSizeValue; ++i) {
+                m_Slices[i][Chunk] = static_cast<uint16_t>(
+                    _mm_movemask_epi8(_mm_slli_epi64(Columns[i / 8], static_cast<int>(7 - i % 8)))
+                );
+            }
+        }
+
+        return *this;
+    }
+
+    void Store(ElementType Elements[], size_t Count) const {
+        if (Count > BatchSizeValue) {
+            throw std::length_error("Too many elements for one batch.");
+        }
+
+        for (size_t Chunk = 0; Chunk * 16 < Count; ++Chunk) {
+            alignas(16) uint8_t Bytes[16][16] = {};
+
+            for (size_t c = 0; c < 16; ++c) {
+                alignas(16) uint16_t Rows[8] = {};
+                for (size_t s = 0; s < 8 && 8 * c + s < BinaryBitSizeValue; ++s) {
+                    Rows[s] = m_Slices[8 * c + s][Chunk];
+                }
+
+                // byte s = bits of element 0 ~ 7 in slice 8 * c + s, byte 8 + s = bits of element 8 ~ 15
+                __m128i v = _mm_load_si128(reinterpret_cast<const __m128i*>(Rows));
+                v = _mm_packus_epi16(
+                    _mm_and_si128(v, _mm_set1_epi16(0xff)),
+                    _mm_srli_epi16(v, 8)
+                );
+
+                for (size_t t = 0; t < 8; ++t) {
+                    int Mask = _mm_movemask_epi8(_mm_slli_epi64(v, static_cast<int>(7 - t)));
+                    Bytes[t][c] = static_cast<uint8_t>(Mask);
+                    Bytes[t + 8][c] = static_cast<uint8_t>(Mask >> 8);
+                }
+            }
+
+            for (size_t k = 0; k < 16 && 16 * Chunk + k < Count; ++k) {
+                Elements[16 * Chunk + k] = _mm_load_si128(reinterpret_cast<const __m128i*>(Bytes[k]));
+            }
+        }
+    }
+
+    [[nodiscard]]
+    BitslicedVisualAssistField operator+(const BitslicedVisualAssistField& Other) const noexcept {
+        BitslicedVisualAssistField Result(*this);
+        Result += Other;
+        return Result;
+    }
+
+    BitslicedVisualAssistField& operator+=(const BitslicedVisualAssistField& Other) noexcept {
+        for (size_t i = 0; i < BinaryBitSizeValue; ++i) {
+            StoreSlice(i, __Lanes::Xor(LoadSlice(i), Other.LoadSlice(i)));
+        }
+        return *this;
+    }
+
+    [[nodiscard]]
+    BitslicedVisualAssistField operator*(const BitslicedVisualAssistField& Other) const noexcept {
+        BitslicedVisualAssistField Result(nullptr);
+        MultiplySlices(Result, *this, Other);
+        return Result;
+    }
+
+    BitslicedVisualAssistField& operator*=(const BitslicedVisualAssistField& Other) noexcept {
+        MultiplySlices(*this, BitslicedVisualAssistField(*this), Other);
+        return *this;
+    }
+
+    BitslicedVisualAssistField& Square() noexcept {
+        RotateSlices(*this, BitslicedVisualAssistField(*this), 1);
+        return *this;
+    }
+
+    [[nodiscard]]
+    BitslicedVisualAssistField SquareValue() const noexcept {
+        BitslicedVisualAssistField Result(nullptr);
+        RotateSlices(Result, *this, 1);
+        return Result;
+    }
+
+    // The same addition chain as `VisualAssistFieldTraitsBase::Inverse`, zero elements stay zero.
+    [[nodiscard]]
+    BitslicedVisualAssistField InverseValue() const noexcept {
+        BitslicedVisualAssistField eta(*this);
+        BitslicedVisualAssistField mu(nullptr);
+
+        for (size_t i = 1; i < sizeof(VisualAssistFieldTraits::InverseAdditionChain); ++i) {
+            size_t k = VisualAssistFieldTraits::InverseAdditionChain[i - 1];
+
+            if (VisualAssistFieldTraits::InverseAdditionChain[i] == 2 * k) {
+                RotateSlices(mu, eta, k);
+                eta *= mu;
+            } else {
+                RotateSlices(mu, eta, 1);
+                MultiplySlices(eta, mu, *this);
+            }
+        }
+
+        return eta.Square();
+    }
+
+    BitslicedVisualAssistField& Inverse() noexcept {
+        *this = InverseValue();
+        return *this;
+    }
+};
+
@@ -0,0 +1,275 @@
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+#include <stdexcept>
+#include <random>
+#include <vector>
+#include "BigInteger.hpp"
+#include "FixedBasePrecomp.hpp"
+#include "GaloisField.hpp"
+
+// Many ECDSA signatures at once, where (r, s) on a hash integer h under a public key Q is valid
+// if r = x(R) mod n for R = (h / s) * G + (r / s) * Q, with x(R) read as a little-endian integer.
+//
+// R is recovered from r up to its sign: x(R) is one of r, r + n, ... below 2^m, and y(R) a root of y^2 + x * y = x^3 + a * x^2 + b.
+// A group of signatures is then checked by one random linear combination
+//     (sum of z_i * h_i / s_i) * G + sum over Q of (sum of z_i * r_i / s_i) * Q = sum of z_i * (+-R_i),
+// where the left side is one multi-scalar multiplication, and the right side is searched over the signs and candidates of every R_i.
+// The search grows exponentially, so groups are small. A failing group is bisected down to single signatures, verified one by one.
+//
+// The candidates of R must be of order n, or a wrong R_i off by a point of order 2 would pass for every even z_i.
+// With the cofactor h = 2 they are exactly the points with Tr(x) = Tr(a); other curves verify every signature one by one.
+// On Koblitz curves z_i = a_i + b_i * tau with a_i, b_i of 32 bits, acting as a_i + b_i * lambda on the points of order n,
+// so that z_i * R_i takes half the Frobenius maps and additions of a scalar mod n.
+// Karati, Das, Roychowdhury, Bellur, Bhattacharya. Batch Verification of ECDSA Signatures. AFRICACRYPT 2012
+template<typename __CurveType>
+class EcdsaBatchVerifier {
+public:
+
+    using PointType = typename __CurveType::Point;
+    using FieldType = typename __CurveType::FieldType;
+
+    // (r, s) on the hash integer h under the public key Q
+    struct Signature {
+        BigInteger Hash;
+        BigInteger R;
+        BigInteger S;
+        const PointType* lpPublicKey;
+    };
+
+    // The sums compared for a group at most, which bounds its size to 5 signatures or so.
+    static constexpr size_t MaxCombinationCount = 16;
+
+private:
+
+    // u1 = h / s, u2 = r / s and the candidates of R up to sign, affine
+    struct Prepared {
+        BigInteger U1;
+        BigInteger U2;
+        std::vector<PointType> Candidates;
+    };
+
+    const __CurveType& m_Curve;
+    PointType m_Base;
+    const FixedBasePrecomp<__CurveType>* m_lpBaseTable;
+    bool m_IsBatchable;
+    std::mt19937_64 m_Random;
+
+    // False if the signature is out of range. No candidate leaves it to `VerifyOne`.
+    [[nodiscard]]
+    bool Prepare(Prepared& P, const Signature& Sig) const {
+        const auto& n = m_Curve.m_Order;
+
+        if (Sig.R < 1 || n <= Sig.R || Sig.S < 1 || n <= Sig.S) {
+            return false;
+        }
+
+        auto w = Sig.S.InverseModValue(n);
+        P.U1 = Sig.Hash * w;
+        P.U1 %= n;
+        P.U2 = Sig.R * w;
+        P.U2 %= n;
+
+        P.Candidates.clear();
+
+        if (m_IsBatchable == false) {
+            return true;
+        }
+
+        size_t ByteSize = (FieldType::BinaryBitSizeValue + 7) / 8;
+        FieldType One{ GaloisFieldInitByOne{} };
+
+        for (BigInteger x = Sig.R; x.BitLength() <= FieldType::BinaryBitSizeValue; x += n) {
+            auto Bytes = x.DumpAbsoluteValue(BigIntegerEndian::Little);
+            Bytes.resize(ByteSize);
+
+            FieldType X(GaloisFieldInitByBinary{}, Bytes);
+            if (X.IsZero() || X.Trace() != m_Curve.m_A.Trace()) {
+                continue;
+            }
+
+            auto t = X + m_Curve.m_A;
+            t *= X.SquareValue();
+            t += m_Curve.m_B;
+
+            FieldType Roots[2];
+            if (FieldType::SolveQuadratic(Roots, One, X, t) == 2) {
+                PointType Candidate(m_Curve);
+                Candidate.m_X = X;
+                Candidate.m_Y = Roots[0];
+                Candidate.m_Z = One;
+                P.Candidates.emplace_back(std::move(Candidate));
+            }
+        }
+
+        return true;
+    }
+
+    [[nodiscard]]
+    bool VerifyOne(const Signature& Sig, const Prepared& P) const {
+        PointType R = m_lpBaseTable ?
+            m_Curve.MultiScalarMul(*m_lpBaseTable, P.U1, { *Sig.lpPublicKey }, { P.U2 }) :
+            m_Curve.MultiScalarMul({ m_Base, *Sig.lpPublicKey }, { P.U1, P.U2 });
+
+        if (R.IsAtInfinity()) {
+            return false;
+        }
+
+        BigInteger x(false, R.GetX().Serialize(), BigIntegerEndian::Little);
+        x %= m_Curve.m_Order;
+
+        return x == Sig.R;
+    }
+
+    // Sum + sum of +-Terms[i][j_i] for i >= k compared with +-Target, where the sign of Terms[0][j_0] is fixed as Target's stands for both.
+    [[nodiscard]]
+    static bool Search(const std::vector<std::vector<PointType>>& Terms, size_t k, const PointType& Sum, const PointType& Target) {
+        if (k == Terms.size()) {
+            return Sum == Target || Sum == -Target;
+        }
+
+        for (const auto& Term : Terms[k]) {
+            if (Search(Terms, k + 1, Sum + Term, Target)) {
+                return true;
+            }
+
+            if (k > 0 && Search(Terms, k + 1, Sum - Term, Target)) {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    [[nodiscard]]
+    bool VerifyGroup(const Signature Signatures[], const Prepared Prepares[], const size_t Indices[], size_t Count) {
+        const auto& n = m_Curve.m_Order;
+        const auto& Lambda = m_Curve.m_TauAdic.Lambda;
+
+        BigInteger BaseScalar;
+        std::vector<PointType> Keys;
+        std::vector<BigInteger> KeyScalars;
+        std::vector<std::vector<PointType>> Terms(Count);
+
+        for (size_t k = 0; k < Count; ++k) {
+            const auto& Sig = Signatures[Indices[k]];
+            const auto& P = Prepares[Indices[k]];
+
+            BigInteger Zeta;
+
+            // Only the ratios of the z_i count, so z_0 = 1.
+            if (k == 0) {
+                Zeta = 1;
+                Terms[k] = P.Candidates;
+            } else if (m_Curve.m_IsKoblitz && Lambda.IsZero() == false) {
+                uint64_t Random = m_Random() | 1;
+                BigInteger a(Random & 0xffffffff);
+                BigInteger b(Random >> 32);
+
+                Zeta = a + b * Lambda;
+                Zeta %= n;
+
+                for (const auto& Candidate : P.Candidates) {
+                    Terms[k].emplace_back(Candidate.MultiplyByTauAdicNaf(a, b));
+                }
+            } else {
+                Zeta = BigInteger(m_Random() | 1);
+
+                for (const auto& Candidate : P.Candidates) {
+                    Terms[k].emplace_back(Candidate.MultiplyByWindowNaf(Zeta));
+                }
+            }
+
+            BaseScalar += Zeta * P.U1;
+
+            size_t j = 0;
+            while (j < Keys.size() && Keys[j] != *Sig.lpPublicKey) {
+                ++j;
+            }
+
+            if (j == Keys.size()) {
+                Keys.push_back(*Sig.lpPublicKey);
+                KeyScalars.emplace_back();
+            }
+
+            KeyScalars[j] += Zeta * P.U2;
+        }
+
+        BaseScalar %= n;
+        for (auto& Scalar : KeyScalars) {
+            Scalar %= n;
+        }
+
+        PointType Target(m_Curve);
+        if (m_lpBaseTable) {
+            Target = m_Curve.MultiScalarMul(*m_lpBaseTable, BaseScalar, Keys.data(), KeyScalars.data(), Keys.size());
+        } else {
+            Keys.push_back(m_Base);
+            KeyScalars.push_back(BaseScalar);
+            Target = m_Curve.MultiScalarMul(Keys.data(), KeyScalars.data(), Keys.size());
+        }
+
+        return Search(Terms, 0, PointType(m_Curve), Target);
+    }
+
+    void Bisect(const Signature Signatures[], const Prepared Prepares[], const size_t Indices[], size_t Count, bool Results[]) {
+        if (Count == 1) {
+            Results[Indices[0]] = VerifyOne(Signatures[Indices[0]], Prepares[Indices[0]]);
+        } else if (VerifyGroup(Signatures, Prepares, Indices, Count)) {
+            for (size_t k = 0; k < Count; ++k) {
+                Results[Indices[k]] = true;
+            }
+        } else {
+            Bisect(Signatures, Prepares, Indices, Count / 2, Results);
+            Bisect(Signatures, Prepares, Indices + Count / 2, Count - Count / 2, Results);
+        }
+    }
+
+public:
+
+    // The curve of Base must know its order n and cofactor h. A table of Base speeds up the multi-scalar multiplications.
+    EcdsaBatchVerifier(const PointType& Base, const FixedBasePrecomp<__CurveType>* lpBaseTable = nullptr) :
+        m_Curve(Base.m_Curve),
+        m_Base(Base),
+        m_lpBaseTable(lpBaseTable),
+        m_IsBatchable(Base.m_Curve.m_Cofactor == 2),
+        m_Random(std::random_device{}())
+    {
+        if (m_Curve.m_Order.IsZero()) {
+            throw std::invalid_argument("The order of the curve is unknown.");
+        }
+    }
+
+    // Results[i] tells if Signatures[i] is valid.
+    void Verify(const Signature Signatures[], size_t Count, bool Results[]) {
+        std::vector<Prepared> Prepares(Count);
+        std::vector<size_t> Group;
+        size_t CombinationCount = 1;
+
+        for (size_t i = 0; i < Count; ++i) {
+            if (Prepare(Prepares[i], Signatures[i]) == false) {
+                Results[i] = false;
+                continue;
+            }
+
+            size_t OptionCount = 2 * Prepares[i].Candidates.size();
+            if (OptionCount == 0) {
+                Results[i] = VerifyOne(Signatures[i], Prepares[i]);
+                continue;
+            }
+
+            if (Group.size() > 0 && CombinationCount * OptionCount > 2 * MaxCombinationCount) {
+                Bisect(Signatures, Prepares.data(), Group.data(), Group.size(), Results);
+                Group.clear();
+                CombinationCount = 1;
+            }
+
+            Group.push_back(i);
+            CombinationCount *= OptionCount;
+        }
+
+        if (Group.size() > 0) {
+            Bisect(Signatures, Prepares.data(), Group.data(), Group.size(), Results);
+        }
+    }
+};
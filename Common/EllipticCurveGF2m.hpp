@@ -3,24 +3,1091 @@
 #include <stdint.h>
 #include <stdexcept>
 #include <algorithm>
+#include <array>
+#include <initializer_list>
+#include <thread>
+#include <utility>
+#include <vector>
 #include "BigInteger.hpp"
+#include "FixedUInt.hpp"
+#include "GaloisField.hpp"
+#include "WorkStealingQueue.hpp"
+#include "WorkerPool.hpp"
+
+// How `EllipticCurveGF2m::Point::Multiply` walks the scalar.
+enum class ScalarMulStrategy {
+    DoubleAndAdd,       // left-to-right, one mixed addition per set bit
+    MontgomeryLadder,   // x-only, one addition and one doubling for every bit
+    TauAdicNaf,         // Koblitz curves only, Frobenius maps instead of doublings, falls back to WindowNaf otherwise
+    WindowNaf,          // left-to-right width-w NAF, one mixed addition per w + 1 bits on average
+    HalveAndAdd,        // right-to-left width-w NAF with halvings, for points of order n on curves with Tr(A) = 1 and n known
+};
+
+template<typename __CurveType>
+class FixedBasePrecomp;
+
+template<typename __CurveType>
+class EcdsaBatchVerifier;
+
+template<typename __CurveType>
+class PointBatch;
+
+template<typename __FieldType, unsigned __A, unsigned __B>
+class StaticCurve;
 
 template<typename __FieldType>
 class EllipticCurveGF2m {
+public:
+
+    using FieldType = __FieldType;
+
 private:
 
+    template<typename __CurveType>
+    friend class EcdsaBatchVerifier;
+
+    template<typename __StaticFieldType, unsigned __A, unsigned __B>
+    friend class StaticCurve;
+
     // y^2 + xy = x^3 + Ax^2 + B
     __FieldType m_A;
     __FieldType m_B;
 
+    // n and h where #E = h * n and n is the prime order of the base points, or zeros if unknown
+    BigInteger m_Order;
+    BigInteger m_Cofactor;
+
+    // Points of odd order can be halved when Tr(A) = 1, and k * P = (k * 2^t mod n) * P / 2^t where t = n.BitLength().
+    bool m_IsHalvable;
+    BigInteger m_HalvingFactor;         // 2^t mod n
+
+    // Widths of NAFs, both the tau-adic and the binary one, are 2 to MaxNafWidth, with 2^(w - 2) odd digits.
+    static constexpr unsigned MaxNafWidth = 6;
+
+    // A Koblitz curve has A = 0 or 1 and B = 1, where the Frobenius map tau(x, y) = (x^2, y^2) is an endomorphism with
+    //     tau^2 = mu * tau - 2,    mu = (-1)^(1 - A),
+    // so that an element r0 + r1 * tau of Z[tau] acts on a point P as r0 * P + r1 * tau(P).
+    struct TauAdicParameters {
+        int Mu;
+        unsigned Width;                                 // of the tau-adic NAF
+        uint64_t Tw;                                    // tau mod tau ^ Width, as an integer mod 2 ^ Width
+        int64_t Alphas[1u << (MaxNafWidth - 2)][2];        // alpha_u = u mods tau ^ Width for odd u, as (r0, r1)
+        BigInteger Modulus[2];                          // tau ^ m - 1, which every point is killed by
+        BigInteger Norm;                                // N(tau ^ m - 1), the number of points
+        BigInteger Lambda;                              // tau(P) = lambda * P for P of order n, or zero if n is unknown
+    };
+
+    bool m_IsKoblitz;
+    TauAdicParameters m_TauAdic;
+
+    // q = Q0 + Q1 * tau, the element of Z[tau] nearest to (G0 + G1 * tau) / D where D > 0, so that N(lambda - q) <= 4 / 7.
+    // Every comparison of the algorithm is multiplied by D.
+    // Hankerson, Menezes, Vanstone. Guide to Elliptic Curve Cryptography. Algorithm 3.61
+    static void RoundOff(BigInteger& Q0, BigInteger& Q1, const BigInteger& G0, const BigInteger& G1, const BigInteger& D, int Mu) noexcept {
+        BigInteger TwoD = D + D;
+
+        Q0 = (G0 + G0 + D) / TwoD;
+        Q1 = (G1 + G1 + D) / TwoD;
+
+        BigInteger E0 = G0 - Q0 * D;                    // eta0 * D
+        BigInteger E1 = G1 - Q1 * D;                    // eta1 * D
+        if (Mu < 0) {
+            E1.Negate();                                // mu * eta1 * D
+        }
+
+        BigInteger Eta = E0 + E0 + E1;
+        BigInteger E3 = E0 - E1 - E1 - E1;
+        BigInteger E4 = E0 + (E1 + E1) + (E1 + E1);
+
+        int h0 = 0, h1 = 0;
+
+        if (Eta >= D) {
+            if (E3 < -D) {
+                h1 = Mu;
+            } else {
+                h0 = 1;
+            }
+        } else if (E4 >= TwoD) {
+            h1 = Mu;
+        }
+
+        if (Eta < -D) {
+            if (E3 >= D) {
+                h1 = -Mu;
+            } else {
+                h0 = -1;
+            }
+        } else if (E4 < -TwoD) {
+            h1 = -Mu;
+        }
+
+        Q0 += BigInteger(h0);
+        Q1 += BigInteger(h1);
+    }
+
+    void SetupTauAdicParameters() noexcept {
+        auto& T = m_TauAdic;
+
+        T.Mu = m_A.IsOne() ? 1 : -1;
+
+        // tau ^ (i + 1) = tau * (a + b * tau) = -2 * b + (a + mu * b) * tau
+        BigInteger a(1), b(0);
+        for (size_t i = 0; i < __FieldType::BinaryBitSizeValue; ++i) {
+            BigInteger t = T.Mu > 0 ? a + b : a - b;
+            a = -(b + b);
+            b = t;
+        }
+
+        // N(a + b * tau) = a^2 + mu * a * b + 2 * b^2
+        T.Modulus[0] = a - BigInteger(1);
+        T.Modulus[1] = b;
+        T.Norm = T.Modulus[0] * (T.Mu > 0 ? T.Modulus[0] + b : T.Modulus[0] - b) + BigInteger(2) * b * b;
+
+        T.Width = GetNafWidth(__FieldType::BinaryBitSizeValue);
+
+        int64_t c0 = 1, c1 = 0;
+        for (unsigned i = 0; i < T.Width; ++i) {
+            int64_t t = c0 + T.Mu * c1;
+            c0 = -2 * c1;
+            c1 = t;
+        }
+
+        // tau ^ Width = c0 + c1 * tau is sent to 0, and c1 is odd.
+        uint64_t Mask = (uint64_t{1} << T.Width) - 1;
+        for (T.Tw = 0; ((static_cast<uint64_t>(c0) + static_cast<uint64_t>(c1) * T.Tw) & Mask) != 0; ++T.Tw) {}
+
+        // u / tau ^ Width = u * conj(tau ^ Width) / 2 ^ Width, where conj(c0 + c1 * tau) = c0 + mu * c1 - c1 * tau
+        for (int64_t u = 1; u < int64_t{1} << (T.Width - 1); u += 2) {
+            BigInteger q0, q1;
+            RoundOff(q0, q1, BigInteger(u * (c0 + T.Mu * c1)), BigInteger(-u * c1), BigInteger(int64_t{1} << T.Width), T.Mu);
+
+            // alpha_u = u - q * tau ^ Width, with q * (c0 + c1 * tau) = q0 * c0 - 2 * q1 * c1 + (q0 * c1 + q1 * (c0 + mu * c1)) * tau
+            int64_t Q0 = q0.ToInteger<int64_t>();
+            int64_t Q1 = q1.ToInteger<int64_t>();
+            T.Alphas[u / 2][0] = u - Q0 * c0 + 2 * Q1 * c1;
+            T.Alphas[u / 2][1] = -(Q0 * c1 + Q1 * (c0 + T.Mu * c1));
+        }
+
+        // delta = (tau ^ m - 1) / (tau - 1) = (tau ^ m - 1) * (conj(tau) - 1) / h, where h = N(tau - 1) = 3 - mu,
+        // kills the points of order n only, so that d0 + d1 * lambda = 0 mod n.
+        if (m_Order.IsZero() == false) {
+            BigInteger h(3 - T.Mu);
+            BigInteger d0 = T.Modulus[0] * BigInteger(T.Mu - 1) + BigInteger(2) * T.Modulus[1];
+            BigInteger d1 = -(T.Modulus[0] + T.Modulus[1]);
+
+            if ((d0 % h).IsZero() && (d1 % h).IsZero()) {
+                d0 /= h;
+                d1 /= h;
+                if ((d1 % m_Order).IsZero() == false) {
+                    T.Lambda = -d0 * d1.InverseModValue(m_Order);
+                    T.Lambda %= m_Order;
+                }
+            }
+        }
+    }
+
+    // Width-w tau-adic NAF of N = N0 + N1 * tau, i.e. N = sum of Digits[i] * tau ^ i where a digit 0 stands for 0 and a digit +-u for +-alpha_u.
+    // N is partially reduced modulo tau ^ m - 1 first, so there are about m digits whatever N's size is.
+    // The reduction is not modulo (tau ^ m - 1) / (tau - 1), which kills the subgroup of order n only.
+    // Hankerson, Menezes, Vanstone. Guide to Elliptic Curve Cryptography. Algorithm 3.62 and 3.69
+    // Digits are written over the caller's buffer, whose capacity is kept.
+    void TauAdicRecode(std::vector<int8_t>& Digits, const BigInteger& N0, const BigInteger& N1) const noexcept {
+        const auto& T = m_TauAdic;
+        const auto& D0 = T.Modulus[0];
+        const auto& D1 = T.Modulus[1];
+
+        // q = round(N / d) = round(N * conj(d) / N(d)), where conj(d) = S0 - D1 * tau and
+        //     N * conj(d) = N0 * S0 + 2 * N1 * D1 + (N1 * D0 - N0 * D1) * tau
+        BigInteger S0 = T.Mu > 0 ? D0 + D1 : D0 - D1;
+        BigInteger Q0, Q1;
+        RoundOff(Q0, Q1, N0 * S0 + BigInteger(2) * N1 * D1, N1 * D0 - N0 * D1, T.Norm, T.Mu);
+
+        // r = N - q * d, with q * d = Q0 * D0 - 2 * Q1 * D1 + (Q0 * D1 + Q1 * S0) * tau
+        BigInteger R0 = N0 - Q0 * D0 + BigInteger(2) * Q1 * D1;
+        BigInteger R1 = N1 - (Q0 * D1 + Q1 * S0);
+
+        Digits.clear();
+        Digits.reserve(__FieldType::BinaryBitSizeValue + 16);
+
+        uint64_t Mask = (uint64_t{1} << T.Width) - 1;
+        uint64_t Half = uint64_t{1} << (T.Width - 1);
+
+        // u = r0 + r1 * Tw mods 2 ^ Width, for odd r0
+        auto Digit = [&T, Mask, Half](uint64_t r0, uint64_t r1) -> int64_t {
+            uint64_t u = (r0 + r1 * T.Tw) & Mask;
+            return u < Half ? static_cast<int64_t>(u) : static_cast<int64_t>(u) - static_cast<int64_t>(Mask + 1);
+        };
+
+        BigInteger Two(2);
+
+        // r0 = R[i], r1 = R[1 - i], so that dividing by tau moves no BigInteger.
+        BigInteger R[2] = { std::move(R0), std::move(R1) };
+        size_t i = 0;
+
+        // The norm halves at every step, and r0, r1 of 59 bits at most keep far from overflow after that.
+        while (R[i].BitLength() > 59 || R[1 - i].BitLength() > 59) {
+            int64_t u = 0;
+
+            if (R[i].TestBit(0)) {
+                uint64_t r0 = 0, r1 = 0;
+                for (unsigned j = 0; j < T.Width; ++j) {
+                    r0 |= uint64_t{R[i].TestBit(j)} << j;
+                    r1 |= uint64_t{R[1 - i].TestBit(j)} << j;
+                }
+
+                u = Digit(r0, r1);
+
+                const auto& Alpha = T.Alphas[(u < 0 ? -u : u) / 2];
+                if (u < 0) {
+                    R[i] += BigInteger(Alpha[0]);
+                    R[1 - i] += BigInteger(Alpha[1]);
+                } else {
+                    R[i] -= BigInteger(Alpha[0]);
+                    R[1 - i] -= BigInteger(Alpha[1]);
+                }
+            }
+
+            Digits.push_back(static_cast<int8_t>(u));
+
+            // r / tau = r1 + mu * r0 / 2 - r0 / 2 * tau
+            R[i] /= Two;
+            if (T.Mu > 0) {
+                R[1 - i] += R[i];
+            } else {
+                R[1 - i] -= R[i];
+            }
+            R[i].Negate();
+            i = 1 - i;
+        }
+
+        int64_t r0 = R[i].ToInteger<int64_t>();
+        int64_t r1 = R[1 - i].ToInteger<int64_t>();
+
+        while (r0 != 0 || r1 != 0) {
+            int64_t u = 0;
+
+            if (r0 & 1) {
+                u = Digit(static_cast<uint64_t>(r0), static_cast<uint64_t>(r1));
+
+                const auto& Alpha = T.Alphas[(u < 0 ? -u : u) / 2];
+                if (u < 0) {
+                    r0 += Alpha[0];
+                    r1 += Alpha[1];
+                } else {
+                    r0 -= Alpha[0];
+                    r1 -= Alpha[1];
+                }
+            }
+
+            Digits.push_back(static_cast<int8_t>(u));
+
+            int64_t h = r0 / 2;
+            r0 = r1 + T.Mu * h;
+            r1 = -h;
+        }
+    }
+
+    [[nodiscard]]
+    std::vector<int8_t> TauAdicRecode(const BigInteger& N0, const BigInteger& N1) const noexcept {
+        std::vector<int8_t> Digits;
+        TauAdicRecode(Digits, N0, N1);
+        return Digits;
+    }
+
+    // Width w minimizing 2^(w - 2) precomputed points plus BitLength / (w + 1) additions, both being mixed additions roughly.
+    [[nodiscard]]
+    static unsigned GetNafWidth(size_t BitLength) noexcept {
+        unsigned Width = 2;
+
+        for (unsigned w = 3; w <= MaxNafWidth; ++w) {
+            if ((size_t{1} << (w - 2)) + BitLength / (w + 1) < (size_t{1} << (Width - 2)) + BitLength / (Width + 1)) {
+                Width = w;
+            }
+        }
+
+        return Width;
+    }
+
+    // Width-w NAF of |N|, i.e. |N| = sum of Digits[i] * 2 ^ i where every nonzero digit is odd and less than 2^(w - 1) in absolute value,
+    // and any w consecutive digits have one nonzero digit at most.
+    // |N| is exported once into Bytes and recoded from them, with a window of w bits sliding over them.
+    // Digits and Bytes are written over the caller's buffers, whose capacity is kept.
+    template<typename __ScalarType>
+    static void NafRecode(std::vector<int8_t>& Digits, std::vector<uint8_t>& Bytes, const __ScalarType& N, unsigned Width) noexcept {
+        Bytes.resize(std::max<size_t>((N.BitLength() + 7) / 8, 1));
+        N.DumpAbsoluteValue(Bytes.data(), Bytes.size(), BigIntegerEndian::Little);
+
+        auto Bit = [&Bytes](size_t i) -> int64_t {
+            return i / 8 < Bytes.size() ? Bytes[i / 8] >> (i % 8) & 1 : 0;
+        };
+
+        int64_t Half = int64_t{1} << (Width - 1);
+        int64_t Full = int64_t{1} << Width;
+
+        // Window = the w bits of (|N| - digits so far) starting at bit i, and the digits so far make a carry only.
+        int64_t Window = 0;
+        for (unsigned j = 0; j < Width; ++j) {
+            Window |= Bit(j) << j;
+        }
+
+        Digits.clear();
+        Digits.reserve(Bytes.size() * 8 + 1);
+
+        for (size_t i = 0; Window != 0 || i + Width < Bytes.size() * 8; ++i) {
+            int64_t Digit = 0;
+
+            if (Window & 1) {
+                Digit = Window < Half ? Window : Window - Full;
+                Window -= Digit;            // 0 or 2^w
+            }
+
+            Digits.push_back(static_cast<int8_t>(Digit));
+
+            Window >>= 1;
+            Window += Bit(i + Width) << (Width - 1);
+        }
+    }
+
+    template<typename __ScalarType>
+    [[nodiscard]]
+    static std::vector<int8_t> NafRecode(const __ScalarType& N, unsigned Width) noexcept {
+        std::vector<int8_t> Digits;
+        std::vector<uint8_t> Bytes;
+        NafRecode(Digits, Bytes, N, Width);
+        return Digits;
+    }
+
+    // Buffers of the recoders above, which every thread of `MultiplyN` keeps for its whole life.
+    struct RecodeBuffer {
+        std::vector<int8_t> Digits;
+        std::vector<uint8_t> Bytes;
+    };
+
+    [[nodiscard]]
+    static RecodeBuffer& GetThreadRecodeBuffer() noexcept {
+        static thread_local RecodeBuffer Buffer;
+        return Buffer;
+    }
+
+    // Joint sparse form of (|N0|, |N1|), i.e. |Nj| = sum of u_j,i * 2 ^ i with u_j,i in {0, +-1}, and
+    // (u_0,i, u_1,i) nonzero for half of the i only on average.
+    // A column is returned as one digit over the table P0, P1, P0 + P1, P0 - P1, in the encoding of `Point::AddNafDigit`,
+    // i.e. +-1, +-3, +-5 and +-7 for +-P0, +-P1, +-(P0 + P1) and +-(P0 - P1).
+    // Hankerson, Menezes, Vanstone. Guide to Elliptic Curve Cryptography. Algorithm 3.50
+    template<typename __ScalarType>
+    [[nodiscard]]
+    static std::vector<int8_t> JointSparseRecode(const __ScalarType& N0, const __ScalarType& N1) noexcept {
+        std::vector<uint8_t> Bytes[2] = {
+            N0.DumpAbsoluteValue(BigIntegerEndian::Little),
+            N1.DumpAbsoluteValue(BigIntegerEndian::Little)
+        };
+
+        // |Nj| >> i mod 8
+        auto Low = [&Bytes](size_t j, size_t i) -> int {
+            int Value = 0;
+            for (size_t k = 0; k < 3; ++k) {
+                if ((i + k) / 8 < Bytes[j].size()) {
+                    Value |= (Bytes[j][(i + k) / 8] >> ((i + k) % 8) & 1) << k;
+                }
+            }
+            return Value;
+        };
+
+        size_t BitCount = std::max(Bytes[0].size(), Bytes[1].size()) * 8;
+
+        std::vector<int8_t> Digits;
+        Digits.reserve(BitCount + 1);
+
+        // l_j = (|Nj| >> i) + d_j where d_j is 0 or 1
+        int d[2] = {};
+
+        for (size_t i = 0; i < BitCount || d[0] != 0 || d[1] != 0; ++i) {
+            int l[2] = { (Low(0, i) + d[0]) & 7, (Low(1, i) + d[1]) & 7 };
+            int u[2] = {};
+
+            for (size_t j = 0; j < 2; ++j) {
+                if (l[j] & 1) {
+                    u[j] = l[j] & 2 ? -1 : 1;                       // l_j mods 4
+                    if ((l[j] == 3 || l[j] == 5) && (l[1 - j] & 3) == 2) {
+                        u[j] = -u[j];
+                    }
+                }
+            }
+
+            for (size_t j = 0; j < 2; ++j) {
+                if (2 * d[j] == 1 + u[j]) {
+                    d[j] = 1 - d[j];
+                }
+            }
+
+            int Digit;
+            if (u[1] == 0) {
+                Digit = u[0];                   // +-1
+            } else if (u[0] == 0) {
+                Digit = 3 * u[1];               // +-3
+            } else if (u[0] == u[1]) {
+                Digit = 5 * u[0];               // +-5
+            } else {
+                Digit = 7 * u[0];               // +-7
+            }
+
+            Digits.push_back(static_cast<int8_t>(Digit));
+        }
+
+        while (Digits.empty() == false && Digits.back() == 0) {
+            Digits.pop_back();
+        }
+
+        return Digits;
+    }
+
 public:
 
     class Point {
     private:
 
+        friend class EllipticCurveGF2m<__FieldType>;
+
+        template<typename __CurveType>
+        friend class FixedBasePrecomp;
+
+        template<typename __CurveType>
+        friend class EcdsaBatchVerifier;
+
+        template<typename __CurveType>
+        friend class PointBatch;
+
+        template<typename __StaticFieldType, unsigned __A, unsigned __B>
+        friend class StaticCurve;
+
         const EllipticCurveGF2m<__FieldType>& m_Curve;
+
+        // Lopez-Dahab projective coordinates, (x, y) = (X / Z, Y / Z ^ 2).
+        // The infinity point has Z = 0, and affine points have Z = 1.
+        // Group operations never invert, only `GetX`, `GetY`, `Dump` and scalar multiplication normalize.
         __FieldType m_X;
         __FieldType m_Y;
+        __FieldType m_Z;
+
+        // A * Value, free for the usual A = 0 or A = 1
+        [[nodiscard]]
+        __FieldType MultiplyByA(const __FieldType& Value) const noexcept {
+            if (m_Curve.m_A.IsZero()) {
+                return __FieldType::GetValueOfZero();
+            } else if (m_Curve.m_A.IsOne()) {
+                return Value;
+            } else {
+                return m_Curve.m_A * Value;
+            }
+        }
+
+        // B * Value, free for the usual B = 1
+        [[nodiscard]]
+        __FieldType MultiplyByB(const __FieldType& Value) const noexcept {
+            if (m_Curve.m_B.IsOne()) {
+                return Value;
+            } else {
+                return m_Curve.m_B * Value;
+            }
+        }
+
+        // Affine (x, y) by one inversion, or (0, 0) for the infinity point
+        void GetAffine(__FieldType& X, __FieldType& Y) const noexcept {
+            if (m_Z.IsOne()) {
+                X = m_X;
+                Y = m_Y;
+            } else if (m_Z.IsZero()) {
+                X.SetZero();
+                Y.SetZero();
+            } else {
+                auto InverseOfZ = m_Z.InverseValue();
+                X = m_X * InverseOfZ;
+                Y = m_Y * InverseOfZ.Square();
+            }
+        }
+
+        // SEC 1: Elliptic Curve Cryptography
+        //     2.3.5 Field-Element-to-Octet-String Conversion
+        // Big endian, while `Serialize` is little endian.
+        static void DumpElement(const __FieldType& Element, uint8_t* pbBuffer) {
+            uint8_t Bytes[__FieldType::BinaryByteSizeValue];
+            size_t cbBytes = Element.Serialize(Bytes, sizeof(Bytes));
+
+            for (size_t i = 0; i < cbBytes; ++i) {
+                pbBuffer[i] = Bytes[cbBytes - 1 - i];
+            }
+        }
+
+        // SEC 1: Elliptic Curve Cryptography
+        //     2.3.6 Octet-String-to-Field-Element Conversion
+        [[nodiscard]]
+        static __FieldType LoadElement(const uint8_t* pbBytes) {
+            uint8_t Bytes[__FieldType::BinaryByteSizeValue];
+
+            for (size_t i = 0; i < sizeof(Bytes); ++i) {
+                Bytes[i] = pbBytes[sizeof(Bytes) - 1 - i];
+            }
+
+            return __FieldType(GaloisFieldInitByBinary{}, Bytes, sizeof(Bytes));
+        }
+
+        // The rightmost bit of the octet string of Element, which 1 flips whatever the basis is.
+        [[nodiscard]]
+        static unsigned GetRightmostBit(const __FieldType& Element) {
+            uint8_t Bytes[__FieldType::BinaryByteSizeValue];
+            size_t cbBytes = Element.Serialize(Bytes, sizeof(Bytes));
+            return cbBytes > 0 ? Bytes[0] & 1 : 0;
+        }
+
+        // *this = (x, y) where y = x * z for the root z of z^2 + z = x + a + b / x^2 whose rightmost bit is YBit,
+        // or y = sqrt(b) for x = 0. InverseOfX is 1 / x, or 0 for x = 0.
+        void Decompress(const __FieldType& X, const __FieldType& InverseOfX, unsigned YBit) {
+            if (X.IsZero()) {
+                m_X = X;
+                m_Y = m_Curve.m_B.SquareRootValue();
+                m_Z.SetOne();
+                return;
+            }
+
+            auto Beta = X + m_Curve.m_A;
+            Beta += MultiplyByB(InverseOfX.SquareValue());
+
+            __FieldType Z;
+            if (__FieldType::SolveQuadratic(Z, Beta) == false) {
+                throw std::invalid_argument("Serialized point is not on the curve.");
+            }
+
+            if (GetRightmostBit(Z) != YBit) {
+                Z.AddOne();
+            }
+
+            m_X = X;
+            m_Y = X * Z;
+            m_Z.SetOne();
+        }
+
+        // Z = 1, or Z = 0 for the infinity point
+        Point& Normalize() noexcept {
+            if (m_Z.IsZero()) {
+                m_X.SetZero();
+                m_Y.SetZero();
+            } else if (m_Z.IsOne() == false) {
+                GetAffine(m_X, m_Y);
+                m_Z.SetOne();
+            }
+            return *this;
+        }
+
+        Point& SetInfinity() noexcept {
+            m_X.SetZero();
+            m_Y.SetZero();
+            m_Z.SetZero();
+            return *this;
+        }
+
+        // *this += (X2, Y2), a mixed addition with an affine point which is not the infinity point, 8M + 5S
+        // Hankerson, Menezes, Vanstone. Guide to Elliptic Curve Cryptography. Algorithm 3.25
+        Point& AddAffine(const __FieldType& X2, const __FieldType& Y2) noexcept {
+            if (IsAtInfinity()) {
+                m_X = X2;
+                m_Y = Y2;
+                m_Z.SetOne();
+                return *this;
+            }
+
+            auto ZZ = m_Z.SquareValue();
+            auto A = Y2 * ZZ + m_Y;             // A = Y2 * Z1 ^ 2 + Y1
+            auto B = X2 * m_Z + m_X;            // B = X2 * Z1 + X1
+
+            if (B.IsZero()) {
+                return A.IsZero() ? Double() : SetInfinity();
+            }
+
+            auto C = m_Z * B;                   // C = Z1 * B
+            auto E = A * C;                     // E = A * C
+
+            // Z3 = C ^ 2
+            m_Z = C.SquareValue();
+
+            // X3 = A ^ 2 + B ^ 2 * (C + a * Z1 ^ 2) + E
+            C += MultiplyByA(ZZ);
+            m_X = A.Square();
+            m_X += B.Square() * C;
+            m_X += E;
+
+            // Y3 = (E + Z3) * (X3 + X2 * Z3) + (X2 + Y2) * Z3 ^ 2
+            E += m_Z;
+            m_Y = X2 * m_Z;
+            m_Y += m_X;
+            m_Y *= E;
+            m_Y += (X2 + Y2) * m_Z.SquareValue();
+
+            return *this;
+        }
+
+        // *this += (X2 : Y2 : Z2), both projective and neither the infinity point, 14M + 6S
+        // With lambda = A / C where
+        //     A = Y1 * Z2 ^ 2 + Y2 * Z1 ^ 2,    B = X1 * Z2 + X2 * Z1,    C = Z1 * Z2 * B,
+        // the affine formulas become
+        //     Z3 = C ^ 2,    X3 = A ^ 2 + C * (A + B ^ 2) + a * Z3,    Y3 = X3 * (E + Z3) + U * (E * X1 + U * Y1)
+        // where E = A * C and U = Z1 * (Z2 * B) ^ 2.
+        Point& AddProjective(const __FieldType& X2, const __FieldType& Y2, const __FieldType& Z2) noexcept {
+            auto A = m_Y * Z2.SquareValue() + Y2 * m_Z.SquareValue();
+            auto B = m_X * Z2 + X2 * m_Z;
+
+            if (B.IsZero()) {
+                return A.IsZero() ? Double() : SetInfinity();
+            }
+
+            auto C = m_Z * Z2;
+            C *= B;
+
+            auto U = (Z2 * B).Square();
+            U *= m_Z;
+
+            auto E = A * C;
+            auto Z3 = C.SquareValue();
+
+            auto X3 = A.SquareValue();
+            X3 += C * (A + B.Square());
+            X3 += MultiplyByA(Z3);
+
+            // Y3 = X3 * (E + Z3) + U * (E * X1 + U * Y1)
+            m_Y *= U;
+            m_Y += E * m_X;
+            m_Y *= U;
+            m_Y += X3 * (E + Z3);
+
+            m_X = X3;
+            m_Z = Z3;
+
+            return *this;
+        }
+
+        // Left-to-right double-and-add, where every addition is a mixed one with the affine *this.
+        // Inversions are spent on normalizing *this if needed, and the result, only.
+        template<typename __ScalarType>
+        [[nodiscard]]
+        Point MultiplyByDoubleAndAdd(const __ScalarType& N) const noexcept {
+            // TestBit reads a negative N in two's complement, so |N| is walked instead.
+            if (N.IsNegative()) {
+                return -MultiplyByDoubleAndAdd(-ToBigInteger(N));
+            }
+
+            Point Result(m_Curve);
+
+            if (N.IsZero() == false && IsAtInfinity() == false) {
+                Point Base(*this);
+                Base.Normalize();
+
+                for (size_t i = N.BitLength(); i-- > 0;) {
+                    Result.Double();
+                    if (N.TestBit(i) == true) {
+                        Result.AddAffine(Base.m_X, Base.m_Y);
+                    }
+                }
+
+                Result.Normalize();
+            }
+
+            return Result;
+        }
+
+        // Precomputed multiples of a point, for NAF digits of either kind.
+        static constexpr size_t MaxPrecomputedCount = size_t{1} << (MaxNafWidth - 2);
+
+        // (X[i] : Y[i] : Z[i]) to affine by one inversion for all of them, while the infinity points keep Z = 0.
+        static void NormalizeN(__FieldType X[], __FieldType Y[], __FieldType Z[], size_t Count) {
+            __FieldType Buffer[MaxPrecomputedCount];
+            std::vector<__FieldType> HeapBuffer;
+            __FieldType* InverseOfZ = Buffer;
+
+            if (Count > MaxPrecomputedCount) {
+                HeapBuffer.resize(Count);
+                InverseOfZ = HeapBuffer.data();
+            }
+
+            __FieldType::BatchInverse(InverseOfZ, Z, Count);
+
+            for (size_t i = 0; i < Count; ++i) {
+                if (Z[i].IsZero() == false) {
+                    X[i] *= InverseOfZ[i];
+                    Y[i] *= InverseOfZ[i].Square();
+                    Z[i].SetOne();
+                }
+            }
+        }
+
+        // *this += Digit * P, where P = (X[j], Y[j]) is affine and j = |Digit| / 2, unless P is the infinity point, i.e. Z[j] = 0.
+        void AddNafDigit(int Digit, const __FieldType X[], const __FieldType Y[], const __FieldType Z[]) noexcept {
+            size_t j = (Digit < 0 ? -Digit : Digit) / 2;
+
+            if (Digit == 0 || Z[j].IsZero()) {
+                return;
+            } else if (Digit > 0) {
+                AddAffine(X[j], Y[j]);
+            } else {
+                AddAffine(X[j], X[j] + Y[j]);
+            }
+        }
+
+        // Q = P / 2 of odd order, from X = x_P, Lambda = a root of lambda^2 + lambda = x_P + a and t = x_P * Lambda + y_P,
+        // to X = u and Lambda = lambda_Q = u + v / u where Q = (u, v).
+        // 2 * Q = P gives u^2 = x_P * (lambda_Q + 1) + y_P, and Tr(u) = Tr(x_P) = Tr(a) = 1 as both Q and P are doubles,
+        // so a trace tells which root lambda_Q is. Nothing is inverted, and square roots are rotations in a normal basis.
+        // Hankerson, Menezes, Vanstone. Guide to Elliptic Curve Cryptography. Algorithm 3.81
+        static void HalveByTrace(__FieldType& X, __FieldType& Lambda, const __FieldType& t) noexcept {
+            if (t.Trace() == 0) {
+                X += t;                                 // u = sqrt(t + x), lambda_Q = lambda
+            } else {
+                X = t;                                  // u = sqrt(t), lambda_Q = lambda + 1
+                Lambda.AddOne();
+            }
+
+            X.SquareRoot();
+        }
+
+        // *this = Q where 2 * Q = *this and Q has odd order, with *this being affine, of odd order and not the infinity point, 2M
+        bool HalveAffine() noexcept {
+            __FieldType Lambda;
+            if (__FieldType::SolveQuadratic(Lambda, m_X + m_Curve.m_A) == false) {
+                return false;                           // *this is not 2 * Q for any Q
+            }
+
+            auto t = Lambda * m_X;
+            t += m_Y;
+
+            HalveByTrace(m_X, Lambda, t);
+
+            // v = u * (u + lambda_Q)
+            m_Y = m_X + Lambda;
+            m_Y *= m_X;
+
+            return true;
+        }
+
+        // K * *this for a small K where *this is affine, the result is projective.
+        [[nodiscard]]
+        Point MultiplyBySmallInteger(int64_t K) const noexcept {
+            Point Result(m_Curve);
+            uint64_t k = K < 0 ? 0 - static_cast<uint64_t>(K) : static_cast<uint64_t>(K);
+
+            for (size_t i = 64; i-- > 0;) {
+                Result.Double();
+                if (k >> i & 1) {
+                    Result.AddAffine(m_X, m_Y);
+                }
+            }
+
+            return K < 0 ? -Result : Result;
+        }
+
+        // (N0 + N1 * tau) * *this on a Koblitz curve, by Horner's rule over the tau-adic NAF digits,
+        // where a Frobenius map, i.e. three squarings, takes the place of a doubling.
+        // alpha_u * P = r0 * P + r1 * tau(P) is precomputed for every odd u < 2^(w - 1), and normalized by one batch inversion.
+        // Hankerson, Menezes, Vanstone. Guide to Elliptic Curve Cryptography. Algorithm 3.70
+        // The result is projective.
+        // Digits are recoded into the caller's buffer.
+        [[nodiscard]]
+        Point MultiplyByTauAdicNafProjective(const BigInteger& N0, const BigInteger& N1, std::vector<int8_t>& Digits) const noexcept {
+            Point Result(m_Curve);
+
+            if ((N0.IsZero() && N1.IsZero()) || IsAtInfinity()) {
+                return Result;
+            }
+
+            const auto& T = m_Curve.m_TauAdic;
+            m_Curve.TauAdicRecode(Digits, N0, N1);
+
+            Point Base(*this);
+            Base.Normalize();
+
+            Point TauBase(Base);
+            TauBase.Frobenius();
+
+            size_t Count = size_t{1} << (T.Width - 2);
+
+            __FieldType X[MaxPrecomputedCount], Y[MaxPrecomputedCount], Z[MaxPrecomputedCount];
+
+            for (size_t i = 0; i < Count; ++i) {
+                Point Alpha = Base.MultiplyBySmallInteger(T.Alphas[i][0]);
+                Alpha += TauBase.MultiplyBySmallInteger(T.Alphas[i][1]);
+                X[i] = Alpha.m_X;
+                Y[i] = Alpha.m_Y;
+                Z[i] = Alpha.m_Z;
+            }
+
+            NormalizeN(X, Y, Z, Count);
+
+            for (size_t i = Digits.size(); i-- > 0;) {
+                Result.Frobenius();
+                Result.AddNafDigit(Digits[i], X, Y, Z);
+            }
+
+            return Result;
+        }
+
+        [[nodiscard]]
+        Point MultiplyByTauAdicNafProjective(const BigInteger& N0, const BigInteger& N1) const noexcept {
+            std::vector<int8_t> Digits;
+            return MultiplyByTauAdicNafProjective(N0, N1, Digits);
+        }
+
+        [[nodiscard]]
+        Point MultiplyByTauAdicNaf(const BigInteger& N0, const BigInteger& N1) const noexcept {
+            Point Result = MultiplyByTauAdicNafProjective(N0, N1);
+            Result.Normalize();
+            return Result;
+        }
+
+        // The reduction mod tau ^ m - 1 runs on BigInteger, which N is converted to once.
+        template<typename __ScalarType>
+        [[nodiscard]]
+        Point MultiplyByTauAdicNaf(const __ScalarType& N) const noexcept {
+            if (m_Curve.m_IsKoblitz == false) {
+                return MultiplyByWindowNaf(N);
+            }
+
+            return MultiplyByTauAdicNaf(ToBigInteger(N), BigInteger());
+        }
+
+        // Left-to-right width-w NAF with P, 3P, ..., (2^(w - 1) - 1)P precomputed and normalized by one batch inversion,
+        // where a negative digit costs a field addition only as -(x, y) = (x, x + y).
+        // Hankerson, Menezes, Vanstone. Guide to Elliptic Curve Cryptography. Algorithm 3.36
+        // The result is projective. N is recoded into the caller's buffer.
+        template<typename __ScalarType>
+        [[nodiscard]]
+        Point MultiplyByWindowNafProjective(const __ScalarType& N, RecodeBuffer& Buffer) const noexcept {
+            Point Result(m_Curve);
+
+            if (N.IsZero() || IsAtInfinity()) {
+                return Result;
+            }
+
+            unsigned Width = GetNafWidth(N.BitLength());
+            auto& Digits = Buffer.Digits;
+            NafRecode(Digits, Buffer.Bytes, N, Width);
+
+            size_t Count = size_t{1} << (Width - 2);
+
+            __FieldType X[MaxPrecomputedCount], Y[MaxPrecomputedCount], Z[MaxPrecomputedCount];
+
+            Point Multiple(*this);
+            Point Twice = DoubleValue();
+
+            for (size_t i = 0; i < Count; ++i) {
+                if (i > 0) {
+                    Multiple += Twice;
+                }
+                X[i] = Multiple.m_X;
+                Y[i] = Multiple.m_Y;
+                Z[i] = Multiple.m_Z;
+            }
+
+            NormalizeN(X, Y, Z, Count);
+
+            for (size_t i = Digits.size(); i-- > 0;) {
+                Result.Double();
+                Result.AddNafDigit(Digits[i], X, Y, Z);
+            }
+
+            return N.IsNegative() ? -Result : Result;
+        }
+
+        template<typename __ScalarType>
+        [[nodiscard]]
+        Point MultiplyByWindowNafProjective(const __ScalarType& N) const noexcept {
+            RecodeBuffer Buffer;
+            return MultiplyByWindowNafProjective(N, Buffer);
+        }
+
+        template<typename __ScalarType>
+        [[nodiscard]]
+        Point MultiplyByWindowNaf(const __ScalarType& N) const noexcept {
+            Point Result = MultiplyByWindowNafProjective(N);
+            Result.Normalize();
+            return Result;
+        }
+
+        // Infinity points for the accumulators of `MultiplyByHalveAndAdd`, which live on the stack as Point has no default constructor.
+        template<size_t... __Indexes>
+        [[nodiscard]]
+        static std::array<Point, sizeof...(__Indexes)> MakeInfinityPoints(const EllipticCurveGF2m<__FieldType>& Curve, std::index_sequence<__Indexes...>) noexcept {
+            return { { (static_cast<void>(__Indexes), Point(Curve))... } };
+        }
+
+        // k * P = sum of k'_i * P / 2^(t - i) where k' = k * 2^t mod n has the width-w NAF digits k'_i.
+        // P / 2^(t - i) comes from halvings from i = t down to 0, and is added into Q_u for the digits +-u, with Q = sum of u * Q_u at the end.
+        // Hankerson, Menezes, Vanstone. Guide to Elliptic Curve Cryptography. Algorithm 3.91
+        // Points outside the subgroup of order n can't be halved this way, and are multiplied by `operator*` instead.
+        template<typename __ScalarType>
+        [[nodiscard]]
+        Point MultiplyByHalveAndAdd(const __ScalarType& N) const noexcept {
+            if (m_Curve.m_IsHalvable == false) {
+                return *this * N;
+            }
+
+            Point Result(m_Curve);
+
+            if (IsAtInfinity()) {
+                return Result;
+            }
+
+            Point Base(*this);
+            Base.Normalize();
+
+            if (Base.IsInPrimeOrderSubgroup() == false) {
+                return *this * N;
+            }
+
+            const auto& n = m_Curve.m_Order;
+            size_t BitLength = n.BitLength();
+
+            BigInteger K = ToBigInteger(N) * m_Curve.m_HalvingFactor;
+            K %= n;
+
+            unsigned Width = GetNafWidth(BitLength);
+            auto& Buffer = GetThreadRecodeBuffer();
+            auto& Digits = Buffer.Digits;
+            NafRecode(Digits, Buffer.Bytes, K, Width);
+
+            auto Accumulators = MakeInfinityPoints(m_Curve, std::make_index_sequence<MaxPrecomputedCount>{});
+            size_t AccumulatorCount = size_t{1} << (Width - 2);
+
+            // P / 2^(t - i) = (X, Y), or (X, Lambda) in lambda representation after the first halving, which saves v = u * (u + lambda_Q).
+            __FieldType X, Y, Lambda;
+            Base.GetAffine(X, Y);
+
+            for (size_t i = BitLength + 1; i-- > 0;) {
+                int Digit = i < Digits.size() ? Digits[i] : 0;
+
+                if (Digit != 0) {
+                    if (i < BitLength) {
+                        Y = X + Lambda;
+                        Y *= X;
+                    }
+
+                    if (Digit > 0) {
+                        Accumulators[Digit / 2].AddAffine(X, Y);
+                    } else {
+                        Accumulators[-Digit / 2].AddAffine(X, X + Y);
+                    }
+                }
+
+                if (i > 0) {
+                    // Always solvable, as every point of odd order is a double
+                    __FieldType Root;
+                    __FieldType::SolveQuadratic(Root, X + m_Curve.m_A);
+
+                    // t = x * Root + y, where y = x * (x + lambda)
+                    auto t = i < BitLength ? X * (X + Lambda + Root) : X * Root + Y;
+                    Lambda = Root;
+
+                    HalveByTrace(X, Lambda, t);
+                }
+            }
+
+            // sum of u * Q_u = 2 * sum of j * Q_(2j + 1) + sum of Q_u
+            Point Sum(m_Curve);
+            for (size_t j = AccumulatorCount; j-- > 1;) {
+                Sum += Accumulators[j];
+                Result += Sum;
+            }
+            Sum += Accumulators[0];
+
+            Result.Double();
+            Result += Sum;
+
+            Result.Normalize();
+            return Result;
+        }
+
+        // (X1 : Z1) += (X2 : Z2) by the affine x of their difference, 4M + 1S
+        static void LadderAdd(__FieldType& X1, __FieldType& Z1, const __FieldType& X2, const __FieldType& Z2, const __FieldType& x) noexcept {
+            auto T1 = X1 * Z2;
+            auto T2 = X2 * Z1;
+
+            Z1 = T1 + T2;
+            Z1.Square();
+
+            X1 = x * Z1;
+            X1 += T1 * T2;
+        }
+
+        // (X : Z) = 2 * (X : Z), 1M + 4S, and one more M unless B = 1
+        void LadderDouble(__FieldType& X, __FieldType& Z) const noexcept {
+            auto XX = X.SquareValue();
+            auto ZZ = Z.SquareValue();
+
+            Z = XX * ZZ;
+
+            X = XX.Square();
+            X += MultiplyByB(ZZ.Square());
+        }
+
+        // Lopez-Dahab's Montgomery ladder, (X[0] : Z[0]) = k * P and (X[1] : Z[1]) = (k + 1) * P for the bits k read so far.
+        // Only x and z are updated, every bit costs the same LadderAdd and LadderDouble, and y is recovered at the end.
+        // Hankerson, Menezes, Vanstone. Guide to Elliptic Curve Cryptography. Algorithm 3.40
+        template<typename __ScalarType>
+        [[nodiscard]]
+        Point MultiplyByMontgomeryLadder(const __ScalarType& N) const noexcept {
+            // TestBit reads a negative N in two's complement, so |N| is walked instead.
+            if (N.IsNegative()) {
+                return -MultiplyByMontgomeryLadder(-ToBigInteger(N));
+            }
+
+            Point Result(m_Curve);
+
+            if (N.IsZero() || IsAtInfinity()) {
+                return Result;
+            }
+
+            __FieldType x, y;
+            GetAffine(x, y);
+
+            // (0, sqrt(B)) has order 2, and x-only formulas can't tell it from the infinity point.
+            if (x.IsZero()) {
+                return N.TestBit(0) ? Point(m_Curve, x, y) : Result;
+            }
+
+            __FieldType X[2] = { x, x.SquareValue().Square() + m_Curve.m_B };
+            __FieldType Z[2] = { __FieldType::GetValueOfOne(), x.SquareValue() };
+
+            for (size_t i = N.BitLength() - 1; i-- > 0;) {
+                size_t b = N.TestBit(i) ? 1 : 0;
+                LadderAdd(X[1 - b], Z[1 - b], X[b], Z[b], x);
+                LadderDouble(X[b], Z[b]);
+            }
+
+            if (Z[0].IsZero()) {
+                return Result;
+            }
+
+            if (Z[1].IsZero()) {        // k * P = -P
+                Result.m_X = x;
+                Result.m_Y = x + y;
+                Result.m_Z.SetOne();
+                return Result;
+            }
+
+            // x3 = X1 / Z1
+            // y3 = (x + x3) * ((X1 + x * Z1) * (X2 + x * Z2) + (x ^ 2 + y) * Z1 * Z2) / (x * Z1 * Z2) + y
+            auto xZ1 = x * Z[0];
+            auto xZ2 = x * Z[1];
+            auto Z1Z2 = Z[0] * Z[1];
+            auto InverseOfT = (x * Z1Z2).InverseValue();
+
+            Result.m_X = X[0] * xZ2 * InverseOfT;
+
+            Result.m_Y = (X[0] + xZ1) * (X[1] + xZ2);
+            Result.m_Y += (x.SquareValue() + y) * Z1Z2;
+            Result.m_Y *= x + Result.m_X;
+            Result.m_Y *= InverseOfT;
+            Result.m_Y += y;
+
+            Result.m_Z.SetOne();
+            return Result;
+        }
 
     public:
 
@@ -28,15 +1095,18 @@ public:
         Point(const EllipticCurveGF2m<__FieldType>& Curve) noexcept : 
             m_Curve(Curve),
             m_X(__FieldType::GetValueOfZero()),
-            m_Y(__FieldType::GetValueOfZero()) {}
+            m_Y(__FieldType::GetValueOfZero()),
+            m_Z(__FieldType::GetValueOfZero()) {}
 
         // Create point with (X, Y)
         Point(const EllipticCurveGF2m<__FieldType>& Curve, const __FieldType& X, const __FieldType& Y) : 
             m_Curve(Curve), 
             m_X(X), 
-            m_Y(Y) 
+            m_Y(Y),
+            m_Z(__FieldType::GetValueOfOne())
         {
             if (m_X.IsZero() && m_Y.IsZero()) {   // infinity point which is allowed
+                m_Z.SetZero();
                 return;
             }
 
@@ -50,12 +1120,14 @@ public:
         Point(const Point& Other) noexcept :
             m_Curve(Other.m_Curve),
             m_X(Other.m_X),
-            m_Y(Other.m_Y) {}
+            m_Y(Other.m_Y),
+            m_Z(Other.m_Z) {}
 
         Point(Point&& Other) noexcept :
             m_Curve(Other.m_Curve),
             m_X(std::move(Other.m_X)),
-            m_Y(std::move(Other.m_Y)) {}
+            m_Y(std::move(Other.m_Y)),
+            m_Z(std::move(Other.m_Z)) {}
 
         Point& operator=(const Point& Other) {
             if (this == std::addressof(Other)) {
@@ -65,6 +1137,7 @@ public:
             if (m_Curve == Other.m_Curve) {
                 m_X = Other.m_X;
                 m_Y = Other.m_Y;
+                m_Z = Other.m_Z;
                 return *this;
             } else {
                 throw std::invalid_argument("Not on the same curve.");
@@ -79,132 +1152,152 @@ public:
             if (m_Curve == Other.m_Curve) {
                 m_X = std::move(Other.m_X);
                 m_Y = std::move(Other.m_Y);
+                m_Z = std::move(Other.m_Z);
                 return *this;
             } else {
                 throw std::invalid_argument("Not on the same curve.");
             }
         }
 
+        // X1 / Z1 = X2 / Z2 and Y1 / Z1 ^ 2 = Y2 / Z2 ^ 2, cross-multiplied so that nothing is inverted
         [[nodiscard]]
         bool operator==(const Point& Other) const noexcept {
             if (this == &Other) {
                 return true;
+            }
+
+            if (m_Curve != Other.m_Curve) {
+                return false;
+            }
+
+            if (IsAtInfinity() || Other.IsAtInfinity()) {
+                return IsAtInfinity() && Other.IsAtInfinity();
+            }
+
+            if (m_Z == Other.m_Z) {
+                return m_X == Other.m_X && m_Y == Other.m_Y;
             } else {
-                return m_Curve == Other.m_Curve && m_X == Other.m_X && m_Y == Other.m_Y;
+                return m_X * Other.m_Z == Other.m_X * m_Z && m_Y * Other.m_Z.SquareValue() == Other.m_Y * m_Z.SquareValue();
             }
         }
 
         [[nodiscard]]
         bool operator!=(const Point& Other) const noexcept {
-            if (this == &Other) {
-                return false;
-            } else {
-                return m_Curve != Other.m_Curve || m_X != Other.m_X || m_Y != Other.m_Y;
+            return !(*this == Other);
+        }
+
+        [[nodiscard]]
+        bool IsAtInfinity() const noexcept {
+            return m_Z.IsZero();
+        }
+
+        // n * *this = O, for a point on the curve. The points of order n are the whole group if h = 1, and the doubles if h = 2,
+        // which are the points with Tr(x) = Tr(a), so that the check takes a trace, and an inversion unless *this is affine.
+        // Any other cofactor takes a multiplication by n.
+        [[nodiscard]]
+        bool IsInPrimeOrderSubgroup() const {
+            if (IsAtInfinity() || m_Curve.m_Cofactor.IsOne()) {
+                return true;
+            }
+
+            if (m_Curve.m_Cofactor == 2) {
+                return GetX().Trace() == m_Curve.m_A.Trace();
+            }
+
+            if (m_Curve.m_Order.IsZero()) {
+                throw std::invalid_argument("The order of the curve is unknown.");
             }
-        }
 
-        [[nodiscard]]
-        bool IsAtInfinity() const noexcept {
-            return m_X.IsZero() && m_Y.IsZero();
+            return (*this * m_Curve.m_Order).IsAtInfinity();
         }
 
+        // -(x, y) = (x, x + y), i.e. -(X : Y : Z) = (X : X * Z + Y : Z)
         [[nodiscard]]
         Point operator-() const noexcept {
-            if (IsAtInfinity()) {
-                return *this;
-            } else {
-                return Point(m_Curve, m_X, m_X + m_Y);
+            Point Result(*this);
+
+            if (IsAtInfinity() == false) {
+                Result.m_Y += m_Z.IsOne() ? m_X : m_X * m_Z;
             }
+
+            return Result;
         }
 
+        // 4M + 5S, less when A or B is 0 or 1
+        // Hankerson, Menezes, Vanstone. Guide to Elliptic Curve Cryptography. Algorithm 3.24
         Point& Double() noexcept {
             if (IsAtInfinity() == false) {
-                if (m_X.IsZero()) {
-                    m_Y.SetZero();
-                } else {
-                    auto m = m_Y / m_X + m_X;
-
-                    // NewX = m ^ 2 + m + a
-                    __FieldType NewX = m.SquareValue();
-                    NewX += m;
-                    NewX += m_Curve.m_A;
-
-                    // NewY = X ^ 2 + (m + 1) * NewX
-                    m_Y = m.AddOne();
-                    m_Y *= NewX;
-                    m_Y += m_X.Square();
+                auto XX = m_X.SquareValue();
+                auto ZZ = m_Z.SquareValue();
+                auto bZZZZ = MultiplyByB(ZZ.SquareValue());     // b * Z1 ^ 4
+
+                // Z3 = X1 ^ 2 * Z1 ^ 2, which is 0 for the point of order 2
+                m_Z = XX * ZZ;
+
+                // X3 = X1 ^ 4 + b * Z1 ^ 4
+                m_X = XX.Square();
+                m_X += bZZZZ;
+
+                // Y3 = b * Z1 ^ 4 * Z3 + X3 * (a * Z3 + Y1 ^ 2 + b * Z1 ^ 4)
+                m_Y.Square();
+                m_Y += bZZZZ;
+                m_Y += MultiplyByA(m_Z);
+                m_Y *= m_X;
+                m_Y += bZZZZ * m_Z;
+            }
+            return *this;
+        }
 
-                    m_X = NewX;
-                }
+        // tau(x, y) = (x^2, y^2), i.e. (X : Y : Z) maps to (X^2 : Y^2 : Z^2), which is rotations only in a normal basis.
+        // It is an endomorphism on Koblitz curves only.
+        Point& Frobenius() noexcept {
+            if (IsAtInfinity() == false) {
+                m_X.Square();
+                m_Y.Square();
+                m_Z.Square();
             }
             return *this;
         }
 
-        [[nodiscard]]
-        Point DoubleValue() const noexcept {
-            Point Result(m_Curve);
+        // *this = Q where 2 * Q = *this and Q has odd order, as there are two such Q, one of odd order and one of even order.
+        // *this must have odd order on a curve with Tr(A) = 1, i.e. with cofactor 2, like the VA curve.
+        Point& Halve() {
+            if (m_Curve.m_A.Trace() != 1) {
+                throw std::invalid_argument("Halving needs Tr(A) = 1.");
+            }
 
-            if (IsAtInfinity() == false && m_X.IsZero() == false) {
-                // m = X + Y / X
-                auto m = m_Y / m_X + m_X;
+            if (IsAtInfinity()) {
+                return *this;
+            }
 
-                // NewX = m ^ 2 + m + a
-                Result.m_X = m.SquareValue();
-                Result.m_X += m;
-                Result.m_X += m_Curve.m_A;
+            Normalize();
 
-                // NewY = X ^ 2 + (m + 1) * NewX
-                Result.m_Y = m.AddOne();
-                Result.m_Y *= Result.m_X;
-                Result.m_Y += m_X.SquareValue();
+            if (HalveAffine() == false) {
+                throw std::invalid_argument("Point cannot be halved.");
             }
 
-            return Result;
+            return *this;
         }
 
         [[nodiscard]]
-        Point operator+(const Point& Other) const {
-            // must be on the save curve
-            if (m_Curve != Other.m_Curve) {
-                throw std::invalid_argument("Not on the same curve.");
-            }
+        Point HalveValue() const {
+            Point Result(*this);
+            Result.Halve();
+            return Result;
+        }
 
-            if (IsAtInfinity()) {
-                return Other;
-            }
-            
-            if (Other.IsAtInfinity()) {
-                return *this;
-            }
-           
-            if (*this == Other) {
-                // If same point, use double point
-                return DoubleValue();
-            } else {
-                Point Result(m_Curve);
-
-                // if x-coordinates are the same, the result is infinity point
-                // otherwise, do point addition
-                if (m_X != Other.m_X) {
-                    // m = (Y0 + Y1) / (X0 + X1)
-                    auto m = (m_Y + Other.m_Y) / (m_X + Other.m_X);
-
-                    // NewX = m ^ 2 + m + X0 + X1 + a
-                    Result.m_X = m.SquareValue();
-                    Result.m_X += m;
-                    Result.m_X += m_X;
-                    Result.m_X += Other.m_X;
-                    Result.m_X += m_Curve.m_A;
-
-                    // NewY = m * (X0 + NewX) + NewX + Y0
-                    Result.m_Y = m_X + Result.m_X;
-                    Result.m_Y *= m;
-                    Result.m_Y += Result.m_X;
-                    Result.m_Y += m_Y;
-                }
+        [[nodiscard]]
+        Point DoubleValue() const noexcept {
+            Point Result(*this);
+            Result.Double();
+            return Result;
+        }
 
-                return Result;
-            }
+        [[nodiscard]]
+        Point operator+(const Point& Other) const {
+            Point Result(*this);
+            Result += Other;
+            return Result;
         }
 
         Point& operator+=(const Point& Other) {
@@ -220,37 +1313,22 @@ public:
             if (IsAtInfinity()) {
                 m_X = Other.m_X;
                 m_Y = Other.m_Y;
+                m_Z = Other.m_Z;
                 return *this;
             }
-           
-            if (*this == Other) {
-                Double();
+
+            if (Other.m_Z.IsOne()) {
+                return AddAffine(Other.m_X, Other.m_Y);
+            } else if (m_Z.IsOne()) {
+                __FieldType X2 = m_X;
+                __FieldType Y2 = m_Y;
+                m_X = Other.m_X;
+                m_Y = Other.m_Y;
+                m_Z = Other.m_Z;
+                return AddAffine(X2, Y2);
             } else {
-                if (m_X != Other.m_X) {
-                    // m = (Y0 + Y1) / (X0 + X1)
-                    auto m = (m_Y + Other.m_Y) / (m_X + Other.m_X);
-
-                    // NewX = m ^ 2 + m + X0 + X1 + a
-                    auto NewX = m.SquareValue();
-                    NewX += m;
-                    NewX += m_X;
-                    NewX += Other.m_X;
-                    NewX += m_Curve.m_A;
-
-                    // NewY = m * (X0 + NewX) + NewX + Y0
-                    m_X += NewX;
-                    m_X *= m;
-                    m_X += NewX;
-                    m_Y += m_X;
-
-                    m_X = NewX;
-                } else {
-                    m_X.SetZero();
-                    m_Y.SetZero();
-                }
+                return AddProjective(Other.m_X, Other.m_Y, Other.m_Z);
             }
-
-            return *this;
         }
 
         [[nodiscard]]
@@ -264,185 +1342,378 @@ public:
             return *this += -Other;
         }
 
+        // N * *this, normalized to affine coordinates, where N is a BigInteger or a FixedUInt.
+        template<typename __ScalarType>
+        [[nodiscard]]
+        Point Multiply(const __ScalarType& N, ScalarMulStrategy Strategy) const noexcept {
+            switch (Strategy) {
+                case ScalarMulStrategy::MontgomeryLadder:
+                    return MultiplyByMontgomeryLadder(N);
+                case ScalarMulStrategy::TauAdicNaf:
+                    return MultiplyByTauAdicNaf(N);
+                case ScalarMulStrategy::WindowNaf:
+                    return MultiplyByWindowNaf(N);
+                case ScalarMulStrategy::HalveAndAdd:
+                    return MultiplyByHalveAndAdd(N);
+                case ScalarMulStrategy::DoubleAndAdd:
+                default:
+                    return MultiplyByDoubleAndAdd(N);
+            }
+        }
+
+        // tau-adic NAF on Koblitz curves, width-w NAF otherwise
         [[nodiscard]]
         Point operator*(const BigInteger& N) const noexcept {
-            Point Result(m_Curve);
+            return Multiply(N, m_Curve.m_IsKoblitz ? ScalarMulStrategy::TauAdicNaf : ScalarMulStrategy::WindowNaf);
+        }
+
+        template<size_t __Bits>
+        [[nodiscard]]
+        Point operator*(const FixedUInt<__Bits>& N) const noexcept {
+            return Multiply(N, m_Curve.m_IsKoblitz ? ScalarMulStrategy::TauAdicNaf : ScalarMulStrategy::WindowNaf);
+        }
 
-            if (N.IsZero() == false) {
-                Point temp(*this);
-                size_t bit_length = N.BitLength();
+        Point& operator*=(const BigInteger& N) noexcept {
+            Point Result = *this * N;
 
-                for (size_t i = 0; i < bit_length; ++i) {
-                    if (N.TestBit(i) == true)
-                        Result += temp;
-                    temp.Double();
-                }
+            m_X = Result.m_X;
+            m_Y = Result.m_Y;
+            m_Z = Result.m_Z;
 
-                return Result;
-            }
+            return *this;
+        }
 
-            return Result;
+        template<size_t __Bits>
+        Point& operator*=(const FixedUInt<__Bits>& N) noexcept {
+            Point Result = *this * N;
+
+            m_X = Result.m_X;
+            m_Y = Result.m_Y;
+            m_Z = Result.m_Z;
+
+            return *this;
         }
 
-        Point& operator*=(const BigInteger& N) noexcept {
-            if (N.IsZero()) {
-                m_X.SetZero();
-                m_Y.SetZero();
-            } else {
-                Point Result(m_Curve);
-                size_t bit_length = N.BitLength();
+        // Bytes of the encodings below, where the infinity point takes 1 byte in either form.
+        static constexpr size_t EncodedSize = 1 + 2 * __FieldType::BinaryByteSizeValue;
+        static constexpr size_t CompressedEncodedSize = 1 + __FieldType::BinaryByteSizeValue;
 
-                for (size_t i = 0; i < bit_length; ++i) {
-                    if (N.TestBit(i) == true)
-                        Result += *this;
-                    Double();
+        // SEC 1: Elliptic Curve Cryptography
+        //     2.3.3 Elliptic-Curve-Point-to-Octet-String Conversion
+        // 0x04 || x || y into lpBuffer, or 0x00 for the infinity point. The number of bytes written is returned.
+        size_t Dump(void* lpBuffer, size_t cbBuffer) const {
+            auto pbBuffer = reinterpret_cast<uint8_t*>(lpBuffer);
+
+            if (IsAtInfinity()) {
+                if (cbBuffer < 1) {
+                    throw std::length_error("Insufficient buffer.");
                 }
 
-                m_X = Result.m_X;
-                m_Y = Result.m_Y;
+                pbBuffer[0] = 0x00;
+                return 1;
             }
 
-            return *this;
+            if (cbBuffer < EncodedSize) {
+                throw std::length_error("Insufficient buffer.");
+            }
+
+            __FieldType X, Y;
+            GetAffine(X, Y);
+
+            pbBuffer[0] = 0x04;
+            DumpElement(X, pbBuffer + 1);
+            DumpElement(Y, pbBuffer + 1 + __FieldType::BinaryByteSizeValue);
+            return EncodedSize;
         }
 
-        // SEC 1: Elliptic Curve Cryptography
-        //     2.3.3 Elliptic-Curve-Point-to-Octet-String Conversion
         [[nodiscard]]
         std::vector<uint8_t> Dump() const noexcept {
-            if (IsAtInfinity()) {
-                std::vector<uint8_t> bytes = { 0x00 };
-                return bytes;
-            } else {
-                std::vector<uint8_t> bytes = { 0x04 };
-                std::vector<uint8_t> xbytes = m_X.Dump();
-                std::vector<uint8_t> ybytes = m_Y.Dump();
-                std::reverse(xbytes.begin(), xbytes.end());     // to big endian
-                std::reverse(ybytes.begin(), ybytes.end());     // to big endian
-                bytes.insert(bytes.end(), xbytes.begin(), xbytes.end());
-                bytes.insert(bytes.end(), ybytes.begin(), ybytes.end());
-                return bytes;
-            }
+            std::vector<uint8_t> Bytes(IsAtInfinity() ? 1 : EncodedSize);
+            Dump(Bytes.data(), Bytes.size());
+            return Bytes;
         }
 
         // SEC 1: Elliptic Curve Cryptography
         //     2.3.3 Elliptic-Curve-Point-to-Octet-String Conversion
-        [[nodiscard]]
-        std::vector<uint8_t> DumpCompressed() const noexcept {
-            if (IsAtInfinity()) {
-                std::vector<uint8_t> bytes = { 0x00 };
-                return bytes;
-            } else {
-                std::vector<uint8_t> bytes(1);
-                std::vector<uint8_t> xbytes = m_X.Dump();
-                std::vector<uint8_t> zbytes = (m_Y / m_X).Dump();
+        // 0x02 or 0x03 || x into lpBuffer, or 0x00 for the infinity point, where 0x03 tells that the rightmost bit of y / x is 1.
+        // The number of bytes written is returned.
+        size_t DumpCompressed(void* lpBuffer, size_t cbBuffer) const {
+            auto pbBuffer = reinterpret_cast<uint8_t*>(lpBuffer);
 
-                if (zbytes[0] & 1) {
-                    bytes[0] = 0x03;
-                } else {
-                    bytes[0] = 0x02;
+            if (IsAtInfinity()) {
+                if (cbBuffer < 1) {
+                    throw std::length_error("Insufficient buffer.");
                 }
 
-                std::reverse(xbytes.begin(), xbytes.end());     // to big endian
-                bytes.insert(bytes.end(), xbytes.begin(), xbytes.end());
-                return bytes;
+                pbBuffer[0] = 0x00;
+                return 1;
+            }
+
+            if (cbBuffer < CompressedEncodedSize) {
+                throw std::length_error("Insufficient buffer.");
             }
+
+            __FieldType X, Y;
+            GetAffine(X, Y);
+
+            pbBuffer[0] = X.IsZero() || GetRightmostBit(Y / X) == 0 ? 0x02 : 0x03;
+            DumpElement(X, pbBuffer + 1);
+            return CompressedEncodedSize;
         }
 
-        void Load(const std::vector<uint8_t>& SerializedBytes) {
-            if (SerializedBytes.size() == 1 && SerializedBytes[0] == 0) {
-                m_X.SetZero();
-                m_Y.SetZero();
+        [[nodiscard]]
+        std::vector<uint8_t> DumpCompressed() const noexcept {
+            std::vector<uint8_t> Bytes(IsAtInfinity() ? 1 : CompressedEncodedSize);
+            DumpCompressed(Bytes.data(), Bytes.size());
+            return Bytes;
+        }
+
+        // SEC 1: Elliptic Curve Cryptography
+        //     2.3.4 Octet-String-to-Elliptic-Curve-Point Conversion
+        // The uncompressed form, or the infinity point
+        void Load(const void* lpBytes, size_t cbBytes) {
+            auto pbBytes = reinterpret_cast<const uint8_t*>(lpBytes);
+
+            if (cbBytes == 1 && pbBytes[0] == 0x00) {
+                SetInfinity();
                 return;
             }
 
-            if (SerializedBytes.size() == 2 * __FieldType::BinaryByteSizeValue + 1 && SerializedBytes[0] == 0x04) {
-                std::vector<uint8_t> RawNewX(
-                    SerializedBytes.begin() + 1 + 0 * __FieldType::BinaryByteSizeValue, 
-                    SerializedBytes.begin() + 1 + 1 * __FieldType::BinaryByteSizeValue
-                );
-                std::vector<uint8_t> RawNewY(
-                    SerializedBytes.begin() + 1 + 1 * __FieldType::BinaryByteSizeValue, 
-                    SerializedBytes.begin() + 1 + 2 * __FieldType::BinaryByteSizeValue
-                );
-                
-                __FieldType NewX, NewY;
-                NewX.Load(RawNewX);
-                NewY.Load(RawNewY);
-
-                auto Left = NewY.SquareValue() + NewX * NewY;
-                auto Right = (NewX + m_Curve.m_A) * NewX.SquareValue() + m_Curve.m_B;
-                if (Left != Right) {
-                    throw std::invalid_argument("Serialized point is not on the curve.");
-                }
+            if (cbBytes != EncodedSize || pbBytes[0] != 0x04) {
+                throw std::invalid_argument("Invalid serialized bytes.");
+            }
+
+            auto X = LoadElement(pbBytes + 1);
+            auto Y = LoadElement(pbBytes + 1 + __FieldType::BinaryByteSizeValue);
+
+            auto Left = Y.SquareValue() + X * Y;
+            auto Right = (X + m_Curve.m_A) * X.SquareValue() + m_Curve.m_B;
+            if (Left != Right) {
+                throw std::invalid_argument("Serialized point is not on the curve.");
+            }
+
+            m_X = X;
+            m_Y = Y;
+            m_Z.SetOne();
+        }
 
-                m_X = NewX;
-                m_Y = NewY;
+        void Load(const std::vector<uint8_t>& SerializedBytes) {
+            Load(SerializedBytes.data(), SerializedBytes.size());
+        }
+
+        // SEC 1: Elliptic Curve Cryptography
+        //     2.3.4 Octet-String-to-Elliptic-Curve-Point Conversion
+        // The compressed form, or the infinity point
+        void LoadCompressed(const void* lpBytes, size_t cbBytes) {
+            auto pbBytes = reinterpret_cast<const uint8_t*>(lpBytes);
+
+            if (cbBytes == 1 && pbBytes[0] == 0x00) {
+                SetInfinity();
                 return;
             }
 
-            throw std::invalid_argument("Invalid serialized bytes.");
+            if (cbBytes != CompressedEncodedSize || (pbBytes[0] != 0x02 && pbBytes[0] != 0x03)) {
+                throw std::invalid_argument("Invalid serialized bytes.");
+            }
+
+            auto X = LoadElement(pbBytes + 1);
+            Decompress(X, X.IsZero() ? X : X.InverseValue(), pbBytes[0] & 1);
         }
 
         void LoadCompressed(const std::vector<uint8_t>& SerializedBytes) {
-            if (SerializedBytes.size() == 1 && SerializedBytes[0] == 0) {
-                m_X.SetZero();
-                m_Y.SetZero();
-                return;
+            LoadCompressed(SerializedBytes.data(), SerializedBytes.size());
+        }
+
+        // Affine x, which costs an inversion unless the point is affine already, e.g. a result of `operator*`
+        [[nodiscard]]
+        __FieldType GetX() const noexcept {
+            if (m_Z.IsOne() || m_Z.IsZero()) {
+                return m_X;
+            } else {
+                return m_X / m_Z;
             }
+        }
 
-            if (SerializedBytes.size() == 1 + __FieldType::BinaryByteSizeValue && (SerializedBytes[0] == 0x02 || SerializedBytes[0] == 0x03)) {
-                std::vector<uint8_t> RawNewX(
-                    SerializedBytes.begin() + 1 + 0 * __FieldType::BinaryByteSizeValue,
-                    SerializedBytes.begin() + 1 + 1 * __FieldType::BinaryByteSizeValue
-                );
+        // Affine y, which costs an inversion unless the point is affine already, e.g. a result of `operator*`
+        [[nodiscard]]
+        __FieldType GetY() const noexcept {
+            if (m_Z.IsOne() || m_Z.IsZero()) {
+                return m_Y;
+            } else {
+                return m_Y / m_Z.SquareValue();
+            }
+        }
+    };
 
-                __FieldType NewX;
-                NewX.Load(RawNewX);
+private:
 
-                if (NewX.IsZero()) {
-                    m_X = NewX;
-                    m_Y = m_Curve.m_B.SquareRootValue();
-                } else {
-                    auto beta = NewX + m_Curve.m_A + m_Curve.B * NewX.InverseValue().SquareValue();
-                    auto roots = __FieldType::SolveQuadratic(__FieldType::GetOne(), __FieldType::GetOne(), beta);
-                    if (roots.size() < 2) {
-                        throw std::invalid_argument("Serialized point is not on the curve.");
-                    }
+    // Sum of Scalars[i] * Points[i] over one chain of doublings, plus AddColumn(Result, c) at the last ColumnCount steps of it,
+    // through which the comb of a fixed base rides the same chain. The result is projective.
+    // Two points go by their joint sparse form, any other number of them by interleaved width-w NAFs.
+    // On Koblitz curves the points go by interleaved tau-adic NAFs over one chain of Frobenius maps instead, and ColumnCount must be 0.
+    // Hankerson, Menezes, Vanstone. Guide to Elliptic Curve Cryptography. Algorithm 3.48 and 3.51
+    template<typename __ScalarType, typename __ColumnAdderType>
+    [[nodiscard]]
+    Point MultiplyInterleaved(const Point Points[], const __ScalarType Scalars[], size_t Count, size_t ColumnCount, __ColumnAdderType&& AddColumn) const {
+        for (size_t i = 0; i < Count; ++i) {
+            if (Points[i].m_Curve != *this) {
+                throw std::invalid_argument("Not on the same curve.");
+            }
+        }
 
-                    auto zbytes = roots[0].Dump();
-                    if (SerializedBytes[0] == 0x02 && (zbytes[0] & 1 == 0) || SerializedBytes[0] == 0x03 && (zbytes[0] & 1 != 0)) {
-                        m_X = NewX;
-                        m_Y = NewX * roots[0];
-                    } else {
-                        m_X = NewX;
-                        m_Y = NewX * roots[1];
-                    }
+        // Digits[j] refers to the table at Offsets[j] in X, Y and Z, which is normalized by one batch inversion for all of them.
+        std::vector<std::vector<int8_t>> Digits;
+        std::vector<size_t> Offsets;
+        std::vector<__FieldType> X, Y, Z;
+
+        auto Append = [&X, &Y, &Z](const Point& P) {
+            X.push_back(P.m_X);
+            Y.push_back(P.m_Y);
+            Z.push_back(P.m_Z);
+        };
+
+        if (m_IsKoblitz) {
+            size_t TableSize = size_t{1} << (m_TauAdic.Width - 2);
+
+            // every P to affine by one inversion, for alpha_u * P = r0 * P + r1 * tau(P)
+            std::vector<__FieldType> BaseX, BaseY, BaseZ;
+            for (size_t i = 0; i < Count; ++i) {
+                BaseX.push_back(Points[i].m_X);
+                BaseY.push_back(Points[i].m_Y);
+                BaseZ.push_back(Points[i].m_Z);
+            }
+
+            if (Count > 0) {
+                Point::NormalizeN(BaseX.data(), BaseY.data(), BaseZ.data(), Count);
+            }
+
+            for (size_t i = 0; i < Count; ++i) {
+                if (Scalars[i].IsZero() || BaseZ[i].IsZero()) {
+                    continue;
                 }
 
-                return;
+                Digits.emplace_back(TauAdicRecode(ToBigInteger(Scalars[i]), BigInteger()));
+                Offsets.push_back(X.size());
+
+                Point Base(*this);
+                Base.m_X = BaseX[i];
+                Base.m_Y = BaseY[i];
+                Base.m_Z = BaseZ[i];
+                Point TauBase(Base);
+                TauBase.Frobenius();
+
+                for (size_t j = 0; j < TableSize; ++j) {
+                    Point Alpha = Base.MultiplyBySmallInteger(m_TauAdic.Alphas[j][0]);
+                    Alpha += TauBase.MultiplyBySmallInteger(m_TauAdic.Alphas[j][1]);
+                    Append(Alpha);
+                }
+            }
+        } else if (Count == 2) {
+            Point P0 = Scalars[0].IsNegative() ? -Points[0] : Points[0];
+            Point P1 = Scalars[1].IsNegative() ? -Points[1] : Points[1];
+
+            Append(P0);
+            Append(P1);
+            Append(P0 + P1);
+            Append(P0 - P1);
+
+            Digits.emplace_back(JointSparseRecode(Scalars[0], Scalars[1]));
+            Offsets.push_back(0);
+        } else {
+            for (size_t i = 0; i < Count; ++i) {
+                if (Scalars[i].IsZero() || Points[i].IsAtInfinity()) {
+                    continue;
+                }
+
+                unsigned Width = GetNafWidth(Scalars[i].BitLength());
+
+                Digits.emplace_back(NafRecode(Scalars[i], Width));
+                Offsets.push_back(X.size());
+
+                // P, 3P, ..., (2^(w - 1) - 1)P with the sign of the scalar moved into P
+                Point Multiple = Scalars[i].IsNegative() ? -Points[i] : Points[i];
+                Point Twice = Multiple.DoubleValue();
+
+                for (size_t j = 0; j < size_t{1} << (Width - 2); ++j) {
+                    if (j > 0) {
+                        Multiple += Twice;
+                    }
+                    Append(Multiple);
+                }
             }
+        }
 
-            throw std::invalid_argument("Invalid serialized bytes.");
+        if (X.empty() == false) {
+            Point::NormalizeN(X.data(), Y.data(), Z.data(), X.size());
         }
 
-        [[nodiscard]]
-        const __FieldType& GetX() const noexcept {
-            return m_X;
+        size_t Length = 0;
+        for (const auto& d : Digits) {
+            Length = std::max(Length, d.size());
         }
 
-        [[nodiscard]]
-        const __FieldType& GetY() const noexcept {
-            return m_Y;
+        Length = std::max(Length, ColumnCount);
+
+        Point Result(*this);
+
+        for (size_t i = Length; i-- > 0;) {
+            if (m_IsKoblitz) {
+                Result.Frobenius();
+            } else {
+                Result.Double();
+            }
+
+            for (size_t j = 0; j < Digits.size(); ++j) {
+                if (i < Digits[j].size()) {
+                    Result.AddNafDigit(Digits[j][i], &X[Offsets[j]], &Y[Offsets[j]], &Z[Offsets[j]]);
+                }
+            }
+
+            if (i < ColumnCount) {
+                AddColumn(Result, i);
+            }
         }
-    };
+
+        return Result;
+    }
+
+public:
 
     EllipticCurveGF2m(const __FieldType& A, const __FieldType& B) : 
+        EllipticCurveGF2m(A, B, BigInteger(), BigInteger()) {}
+
+    // With the prime order n of the base points and the cofactor h, #E = h * n.
+    EllipticCurveGF2m(const __FieldType& A, const __FieldType& B, const BigInteger& Order, const BigInteger& Cofactor) :
         m_A(A), 
-        m_B(B) 
+        m_B(B),
+        m_Order(Order),
+        m_Cofactor(Cofactor),
+        m_IsHalvable(false),
+        m_IsKoblitz((A.IsZero() || A.IsOne()) && B.IsOne()),
+        m_TauAdic{}
     {
         if (m_B.IsZero()) {
             throw std::invalid_argument("B cannot be zero.");
         }
+
+        if (m_Order.IsNegative() || m_Order.IsOne() || m_Cofactor.IsNegative()) {
+            throw std::invalid_argument("Invalid order or cofactor.");
+        }
+
+        if (m_IsKoblitz) {
+            SetupTauAdicParameters();
+        }
+
+        if (m_Order.IsZero() == false && m_Order.TestBit(0) && m_A.Trace() == 1) {
+            m_IsHalvable = true;
+            m_HalvingFactor.SetBit(m_Order.BitLength());
+            m_HalvingFactor %= m_Order;
+        }
+    }
+
+    [[nodiscard]]
+    bool IsKoblitz() const noexcept {
+        return m_IsKoblitz;
     }
 
     [[nodiscard]]
@@ -465,6 +1736,18 @@ public:
         return m_B;
     }
 
+    // n, or zero if unknown
+    [[nodiscard]]
+    const BigInteger& GetOrder() const noexcept {
+        return m_Order;
+    }
+
+    // h, or zero if unknown
+    [[nodiscard]]
+    const BigInteger& GetCofactor() const noexcept {
+        return m_Cofactor;
+    }
+
     [[nodiscard]]
     Point CreateInfinityPoint() const noexcept {
         return Point(*this);
@@ -474,4 +1757,162 @@ public:
     Point CreatePoint(const __FieldType& X, const __FieldType& Y) const {
         return Point(*this, X, Y);
     }
+
+    // Sum of Scalars[i] * Points[i], normalized to affine coordinates, e.g. u1 * G + u2 * Q of an ECDSA verification.
+    // The scalars are BigInteger or FixedUInt.
+    template<typename __ScalarType>
+    [[nodiscard]]
+    Point MultiScalarMul(const Point Points[], const __ScalarType Scalars[], size_t Count) const {
+        Point Result = MultiplyInterleaved(Points, Scalars, Count, 0, [](Point&, size_t) noexcept {});
+        Result.Normalize();
+        return Result;
+    }
+
+    template<typename __ScalarType>
+    [[nodiscard]]
+    Point MultiScalarMul(std::initializer_list<Point> Points, std::initializer_list<__ScalarType> Scalars) const {
+        if (Points.size() != Scalars.size()) {
+            throw std::invalid_argument("Points and Scalars don't match.");
+        }
+
+        return MultiScalarMul(Points.begin(), Scalars.begin(), Points.size());
+    }
+
+    // BaseScalar * G + sum of Scalars[i] * Points[i] with the table of G, whose comb shares the doublings of the other points.
+    // On Koblitz curves BaseScalar * G is added at the end, as the chain is made of Frobenius maps.
+    template<typename __ScalarType>
+    [[nodiscard]]
+    Point MultiScalarMul(const FixedBasePrecomp<EllipticCurveGF2m<__FieldType>>& Base, const __ScalarType& BaseScalar,
+                         const Point Points[], const __ScalarType Scalars[], size_t Count) const {
+        if (Base.m_Curve != *this) {
+            throw std::invalid_argument("Not on the same curve.");
+        }
+
+        Point Result(*this);
+
+        if (m_IsKoblitz) {
+            Result = MultiplyInterleaved(Points, Scalars, Count, 0, [](Point&, size_t) noexcept {});
+            Result += Base.Multiply(BaseScalar);
+        } else {
+            auto Bytes = Base.Recode(BaseScalar);
+            Result = MultiplyInterleaved(Points, Scalars, Count, Base.m_BlockBitCount, [&Base, &Bytes](Point& P, size_t c) noexcept {
+                Base.AddColumn(P, Bytes, c);
+            });
+        }
+
+        Result.Normalize();
+        return Result;
+    }
+
+    template<typename __ScalarType>
+    [[nodiscard]]
+    Point MultiScalarMul(const FixedBasePrecomp<EllipticCurveGF2m<__FieldType>>& Base, const __ScalarType& BaseScalar,
+                         std::initializer_list<Point> Points, std::initializer_list<__ScalarType> Scalars) const {
+        if (Points.size() != Scalars.size()) {
+            throw std::invalid_argument("Points and Scalars don't match.");
+        }
+
+        return MultiScalarMul(Base, BaseScalar, Points.begin(), Scalars.begin(), Points.size());
+    }
+
+    // Points a thread multiplies before normalizing them by one inversion, and the unit of work stealing.
+    static constexpr size_t MultiplyChunkSize = 16;
+
+    // Results[i] = Scalars[i] * Points[i], normalized to affine coordinates, for many independent pairs.
+    // The pairs are cut into chunks shared by ThreadCount threads of `WorkerPool::Get()` through a `WorkStealingQueue`,
+    // or by every core if ThreadCount = 0.
+    // Every thread multiplies into Results directly, recodes scalars into its own `RecodeBuffer`, and normalizes a chunk with a stack buffer.
+    template<typename __ScalarType>
+    void MultiplyN(Point Results[], const Point Points[], const __ScalarType Scalars[], size_t Count, size_t ThreadCount = 0) const {
+        for (size_t i = 0; i < Count; ++i) {
+            if (Results[i].m_Curve != *this || Points[i].m_Curve != *this) {
+                throw std::invalid_argument("Not on the same curve.");
+            }
+        }
+
+        size_t ChunkCount = (Count + MultiplyChunkSize - 1) / MultiplyChunkSize;
+
+        if (ThreadCount == 0) {
+            ThreadCount = std::max(std::thread::hardware_concurrency(), 1u);
+        }
+
+        ThreadCount = std::max<size_t>(std::min(ThreadCount, ChunkCount), 1);
+
+        WorkStealingQueue Queue(ChunkCount, ThreadCount);
+
+        auto Worker = [this, Results, Points, Scalars, Count, &Queue](size_t t) {
+            auto& Buffer = GetThreadRecodeBuffer();
+            __FieldType InverseOfZ[MultiplyChunkSize];
+            size_t Chunk;
+
+            while (Queue.Pop(t, Chunk)) {
+                size_t First = Chunk * MultiplyChunkSize;
+                size_t Length = std::min(Count - First, MultiplyChunkSize);
+
+                for (size_t i = 0; i < Length; ++i) {
+                    const auto& P = Points[First + i];
+                    const auto& N = Scalars[First + i];
+                    Point R = m_IsKoblitz ?
+                        P.MultiplyByTauAdicNafProjective(ToBigInteger(N), BigInteger(), Buffer.Digits) :
+                        P.MultiplyByWindowNafProjective(N, Buffer);
+
+                    Results[First + i].m_X = R.m_X;
+                    Results[First + i].m_Y = R.m_Y;
+                    Results[First + i].m_Z = R.m_Z;
+                    InverseOfZ[i] = R.m_Z;
+                }
+
+                __FieldType::BatchInverse(InverseOfZ, Length);
+
+                for (size_t i = 0; i < Length; ++i) {
+                    auto& R = Results[First + i];
+                    if (R.IsAtInfinity()) {
+                        R.SetInfinity();
+                    } else {
+                        R.m_X *= InverseOfZ[i];
+                        R.m_Y *= InverseOfZ[i].Square();
+                        R.m_Z.SetOne();
+                    }
+                }
+            }
+        };
+
+        WorkerPool::Get().Run(ThreadCount, Worker);
+    }
+
+    // Encodings decoded by `LoadCompressedN` per inversion, whose buffers live on the stack
+    static constexpr size_t LoadChunkSize = 64;
+
+    // Count compressed encodings of SEC 1 back to back at lpBytes, each of `Point::CompressedEncodedSize` bytes,
+    // decoded into Results with one inversion for every `LoadChunkSize` of them. The infinity point has no encoding of that size.
+    // Results are left unspecified if any encoding is invalid.
+    void LoadCompressedN(Point Results[], const void* lpBytes, size_t Count) const {
+        auto pbBytes = reinterpret_cast<const uint8_t*>(lpBytes);
+        __FieldType X[LoadChunkSize];
+        __FieldType InverseOfX[LoadChunkSize];
+
+        for (size_t First = 0; First < Count; First += LoadChunkSize) {
+            size_t Length = std::min(Count - First, LoadChunkSize);
+
+            for (size_t i = 0; i < Length; ++i) {
+                const uint8_t* pbEncoding = pbBytes + (First + i) * Point::CompressedEncodedSize;
+
+                if (Results[First + i].m_Curve != *this) {
+                    throw std::invalid_argument("Not on the same curve.");
+                }
+
+                if (pbEncoding[0] != 0x02 && pbEncoding[0] != 0x03) {
+                    throw std::invalid_argument("Invalid serialized bytes.");
+                }
+
+                X[i] = Point::LoadElement(pbEncoding + 1);
+            }
+
+            __FieldType::BatchInverse(InverseOfX, X, Length);
+
+            for (size_t i = 0; i < Length; ++i) {
+                Results[First + i].Decompress(X[i], InverseOfX[i], pbBytes[(First + i) * Point::CompressedEncodedSize] & 1);
+            }
+        }
+    }
 };
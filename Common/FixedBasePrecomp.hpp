@@ -0,0 +1,228 @@
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+#include <stdexcept>
+#include <algorithm>
+#include <thread>
+#include <vector>
+#include "BigInteger.hpp"
+#include "FixedUInt.hpp"
+#include "PointBatch.hpp"
+
+// Lim-Lee comb for a point which is fixed for the life of the process, e.g. a generator G of order n.
+// A scalar of l = n.BitLength() bits is cut into w rows of d = ceil(l / w) bits, and every row into v blocks of e = ceil(d / v) bits.
+// For every block j and every nonzero w-bit t, the table holds the affine point
+//     T[j][t] = sum of 2^(i * d + j * e) * G over the set bits i of t,
+// so that k * G takes e - 1 doublings and v * e mixed additions at most.
+// w and v are chosen from a memory limit, and a large enough limit gives e = 1, i.e. k * G without any doubling.
+// Lim, Lee. More Flexible Exponentiation with Precomputation. CRYPTO '94
+template<typename __CurveType>
+class FixedBasePrecomp {
+public:
+
+    using PointType = typename __CurveType::Point;
+    using FieldType = typename __CurveType::FieldType;
+
+    static constexpr unsigned MaxWidth = 16;
+
+private:
+
+    friend __CurveType;
+
+    const __CurveType& m_Curve;
+    BigInteger m_Order;
+
+    unsigned m_Width;           // w
+    size_t m_BlockCount;        // v
+    size_t m_RowBitCount;       // d
+    size_t m_BlockBitCount;     // e
+
+    // T[j][t] is at j * (2^w - 1) + t - 1, and the infinity point is (0, 0), which is never on the curve as B != 0.
+    std::vector<FieldType> m_X;
+    std::vector<FieldType> m_Y;
+
+    // w and v with the fewest expected operations within MemoryLimit bytes, where a mixed addition is taken as two doublings.
+    // Every column of w bits is zero with probability 2^-w, which saves its addition.
+    void ChooseParameters(size_t BitLength, size_t MemoryLimit) noexcept {
+        size_t MaxEntryCount = std::max<size_t>(MemoryLimit / (2 * sizeof(FieldType)), 1);
+        double BestCost = 0;
+
+        m_Width = 0;
+
+        for (unsigned w = 1; w <= MaxWidth && (size_t{1} << w) - 1 <= MaxEntryCount; ++w) {
+            size_t d = (BitLength + w - 1) / w;
+
+            for (size_t e = 1; e <= d; ++e) {
+                size_t v = (d + e - 1) / e;
+                if (v * ((size_t{1} << w) - 1) > MaxEntryCount) {
+                    continue;
+                }
+
+                double Cost = static_cast<double>(e - 1) + 2.0 * static_cast<double>(v * e) * (1.0 - 1.0 / static_cast<double>(size_t{1} << w));
+                if (m_Width == 0 || Cost < BestCost) {
+                    BestCost = Cost;
+                    m_Width = w;
+                    m_BlockCount = v;
+                    m_RowBitCount = d;
+                    m_BlockBitCount = e;
+                }
+            }
+        }
+    }
+
+    // T[j][t] for j = First, First + Step, ... from the affine Basis[i * v + j] = 2^(i * d + j * e) * G.
+    // T[j][2^i + t] = T[j][t] + T[j][2^i] for 0 < t < 2^i, so that every i takes one batch addition.
+    void BuildBlocks(const PointBatch<__CurveType>& Basis, size_t First, size_t Step) {
+        size_t EntryCount = (size_t{1} << m_Width) - 1;
+
+        PointBatch<__CurveType> Entries(m_Curve);
+        Entries.Reserve(EntryCount);
+
+        for (size_t j = First; j < m_BlockCount; j += Step) {
+            Entries.Clear();
+
+            for (size_t i = 0; i < m_Width; ++i) {
+                PointType B = Basis[i * m_BlockCount + j];
+
+                PointBatch<__CurveType> Sums(Entries);
+                Sums.Add(B);
+
+                Entries.Append(B);
+                Entries.Append(Sums);
+            }
+
+            std::copy(Entries.GetX(), Entries.GetX() + EntryCount, m_X.begin() + j * EntryCount);
+            std::copy(Entries.GetY(), Entries.GetY() + EntryCount, m_Y.begin() + j * EntryCount);
+        }
+    }
+
+    // Bytes of K mod n, little endian, where K is a BigInteger or a FixedUInt
+    template<typename __ScalarType>
+    [[nodiscard]]
+    std::vector<uint8_t> Recode(const __ScalarType& K) const noexcept {
+        return (ToBigInteger(K) % m_Order).DumpAbsoluteValue(BigIntegerEndian::Little);
+    }
+
+    // Result += T[j][t] for every block j, where t is made of the bits at column c of the rows of j, 0 <= c < e.
+    void AddColumn(PointType& Result, const std::vector<uint8_t>& Bytes, size_t c) const noexcept {
+        auto Bit = [&Bytes](size_t i) -> size_t {
+            return i / 8 < Bytes.size() ? Bytes[i / 8] >> (i % 8) & 1 : 0;
+        };
+
+        size_t EntryCount = (size_t{1} << m_Width) - 1;
+
+        for (size_t j = 0; j < m_BlockCount && j * m_BlockBitCount + c < m_RowBitCount; ++j) {
+            size_t t = 0;
+            for (size_t i = 0; i < m_Width; ++i) {
+                t |= Bit(i * m_RowBitCount + j * m_BlockBitCount + c) << i;
+            }
+
+            if (t != 0) {
+                const auto& X = m_X[j * EntryCount + t - 1];
+                const auto& Y = m_Y[j * EntryCount + t - 1];
+                if (X.IsZero() == false || Y.IsZero() == false) {
+                    Result.AddAffine(X, Y);
+                }
+            }
+        }
+    }
+
+public:
+
+    // The table takes MemoryLimit bytes at most, blocks of it are built on every core.
+    FixedBasePrecomp(const PointType& Base, const BigInteger& Order, size_t MemoryLimit) :
+        m_Curve(Base.m_Curve),
+        m_Order(Order)
+    {
+        if (Order <= 1) {
+            throw std::invalid_argument("Order must be greater than 1.");
+        }
+
+        ChooseParameters(Order.BitLength(), MemoryLimit);
+
+        // 2^(i * d + j * e) * G, which is increasing in i * v + j since (v - 1) * e < d
+        std::vector<PointType> Multiples;
+        Multiples.reserve(m_Width * m_BlockCount);
+
+        PointType Multiple(Base);
+        size_t Exponent = 0;
+
+        for (size_t i = 0; i < m_Width; ++i) {
+            for (size_t j = 0; j < m_BlockCount; ++j) {
+                for (; Exponent < i * m_RowBitCount + j * m_BlockBitCount; ++Exponent) {
+                    Multiple.Double();
+                }
+                Multiples.push_back(Multiple);
+            }
+        }
+
+        PointBatch<__CurveType> Basis(m_Curve, Multiples.data(), Multiples.size());
+
+        m_X.resize(m_BlockCount * ((size_t{1} << m_Width) - 1));
+        m_Y.resize(m_X.size());
+
+        size_t ThreadCount = std::min<size_t>(std::max(std::thread::hardware_concurrency(), 1u), m_BlockCount);
+
+        std::vector<std::thread> Threads;
+        for (size_t i = 1; i < ThreadCount; ++i) {
+            Threads.emplace_back(&FixedBasePrecomp::BuildBlocks, this, std::cref(Basis), i, ThreadCount);
+        }
+
+        BuildBlocks(Basis, 0, ThreadCount);
+
+        for (auto& Thread : Threads) {
+            Thread.join();
+        }
+    }
+
+    // K * G, normalized to affine coordinates. K is taken modulo the order.
+    template<typename __ScalarType>
+    [[nodiscard]]
+    PointType Multiply(const __ScalarType& K) const noexcept {
+        auto Bytes = Recode(K);
+        PointType Result(m_Curve);
+
+        for (size_t c = m_BlockBitCount; c-- > 0;) {
+            Result.Double();
+            AddColumn(Result, Bytes, c);
+        }
+
+        Result.Normalize();
+        return Result;
+    }
+
+    [[nodiscard]]
+    PointType operator*(const BigInteger& K) const noexcept {
+        return Multiply(K);
+    }
+
+    template<size_t __Bits>
+    [[nodiscard]]
+    PointType operator*(const FixedUInt<__Bits>& K) const noexcept {
+        return Multiply(K);
+    }
+
+    // w, the number of rows
+    [[nodiscard]]
+    unsigned GetWidth() const noexcept {
+        return m_Width;
+    }
+
+    // v, the number of blocks in a row
+    [[nodiscard]]
+    size_t GetBlockCount() const noexcept {
+        return m_BlockCount;
+    }
+
+    // e - 1, the number of doublings in `Multiply`
+    [[nodiscard]]
+    size_t GetDoublingCount() const noexcept {
+        return m_BlockBitCount - 1;
+    }
+
+    // Bytes taken by the table
+    [[nodiscard]]
+    size_t GetMemorySize() const noexcept {
+        return 2 * sizeof(FieldType) * m_X.size();
+    }
+};
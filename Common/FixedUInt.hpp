@@ -0,0 +1,1000 @@
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+#include <stdexcept>
+#include <algorithm>
+#include <initializer_list>
+#include <string>
+#include <type_traits>
+#include <vector>
+#include "BigInteger.hpp"
+#include "Intrinsics.hpp"
+
+// An unsigned integer of __Bits bits held in __Bits / 64 words in place, for scalars and values mod n whose size is bounded,
+// where every BigInteger temporary would go to the heap.
+// Arithmetic wraps around mod 2 ^ __Bits like the built-in unsigned types, so the type must hold the largest intermediate value,
+// e.g. 256 bits for the product of two values mod a 113-bit n.
+// The interface follows BigInteger's for nonnegative values, so that code templated on the integer type takes either.
+// Everything is constexpr. At run time word products go by MULX, `_umul128` or `unsigned __int128`, and carries by ADCX or ADC.
+// These take 64-bit registers, so 32-bit builds, e.g. Win32, run the portable constexpr code at run time as well.
+template<size_t __Bits>
+class FixedUInt {
+public:
+
+    static_assert(__Bits > 0 && __Bits % 64 == 0, "__Bits must be a positive multiple of 64.");
+
+    static constexpr size_t BitSizeValue = __Bits;
+    static constexpr size_t WordCountValue = __Bits / 64;
+
+private:
+
+    template<size_t __OtherBits>
+    friend class FixedUInt;
+
+    uint64_t m_Words[WordCountValue];       // least significant first
+
+    // Low word of A * B, and the high one in High
+    [[nodiscard]]
+    static constexpr uint64_t MultiplyWord(uint64_t A, uint64_t B, uint64_t& High) noexcept {
+#if defined(_M_X64) || defined(__x86_64__)
+        if (__builtin_is_constant_evaluated() == false) {
+#if defined(__BMI2__)
+            unsigned long long h = 0;
+            uint64_t Low = _mulx_u64(A, B, &h);
+            High = h;
+            return Low;
+#elif defined(_MSC_VER)
+            unsigned __int64 h = 0;
+            uint64_t Low = _umul128(A, B, &h);
+            High = h;
+            return Low;
+#else
+            unsigned __int128 Product = static_cast<unsigned __int128>(A) * B;
+            High = static_cast<uint64_t>(Product >> 64);
+            return static_cast<uint64_t>(Product);
+#endif
+        }
+#endif
+
+        uint64_t a0 = A & 0xffffffff, a1 = A >> 32;
+        uint64_t b0 = B & 0xffffffff, b1 = B >> 32;
+        uint64_t p00 = a0 * b0, p01 = a0 * b1, p10 = a1 * b0, p11 = a1 * b1;
+        uint64_t Middle = (p00 >> 32) + (p01 & 0xffffffff) + (p10 & 0xffffffff);
+
+        High = p11 + (p01 >> 32) + (p10 >> 32) + (Middle >> 32);
+        return Middle << 32 | (p00 & 0xffffffff);
+    }
+
+    // Sum = A + B + Carry, returns the carry out
+    static constexpr uint8_t AddWord(uint8_t Carry, uint64_t A, uint64_t B, uint64_t& Sum) noexcept {
+#if defined(_M_X64) || defined(__x86_64__)
+        if (__builtin_is_constant_evaluated() == false) {
+            unsigned long long s = 0;
+#if defined(__ADX__)
+            Carry = _addcarryx_u64(Carry, A, B, &s);
+#else
+            Carry = _addcarry_u64(Carry, A, B, &s);
+#endif
+            Sum = s;
+            return Carry;
+        }
+#endif
+
+        uint64_t s = A + B;
+        uint8_t CarryOut = s < A;
+        Sum = s + Carry;
+        return CarryOut | (Sum < s);
+    }
+
+    // Difference = A - B - Borrow, returns the borrow out
+    static constexpr uint8_t SubtractWord(uint8_t Borrow, uint64_t A, uint64_t B, uint64_t& Difference) noexcept {
+#if defined(_M_X64) || defined(__x86_64__)
+        if (__builtin_is_constant_evaluated() == false) {
+            unsigned long long d = 0;
+            Borrow = _subborrow_u64(Borrow, A, B, &d);
+            Difference = d;
+            return Borrow;
+        }
+#endif
+
+        uint64_t d = A - B;
+        uint8_t BorrowOut = A < B;
+        Difference = d - Borrow;
+        return BorrowOut | (d < Borrow);
+    }
+
+#if !defined(_MSC_VER) && defined(__x86_64__)
+    // DIV, which GCC and Clang don't emit for a 128-bit division but call `__udivti3` instead
+    static uint64_t DivideWordByDiv(uint64_t High, uint64_t Low, uint64_t Divisor, uint64_t& Remainder) noexcept {
+        uint64_t Quotient;
+        __asm__ ("divq %4" : "=a"(Quotient), "=d"(Remainder) : "a"(Low), "d"(High), "rm"(Divisor));
+        return Quotient;
+    }
+#endif
+
+    // Quotient of (High * 2^64 + Low) / Divisor, for High < Divisor
+    [[nodiscard]]
+    static constexpr uint64_t DivideWord(uint64_t High, uint64_t Low, uint64_t Divisor, uint64_t& Remainder) noexcept {
+#if defined(_M_X64) || defined(__x86_64__)
+        if (__builtin_is_constant_evaluated() == false) {
+#if defined(_MSC_VER)
+            unsigned __int64 r = 0;
+            uint64_t Quotient = _udiv128(High, Low, Divisor, &r);
+            Remainder = r;
+            return Quotient;
+#else
+            return DivideWordByDiv(High, Low, Divisor, Remainder);
+#endif
+        }
+#endif
+
+        // bit by bit, where the top bit shifted out of High stands for a remainder of 2^64 or more
+        uint64_t Quotient = 0;
+        for (unsigned i = 0; i < 64; ++i) {
+            uint64_t Top = High >> 63;
+            High = High << 1 | Low >> 63;
+            Low <<= 1;
+            Quotient <<= 1;
+            if (Top != 0 || High >= Divisor) {
+                High -= Divisor;
+                Quotient |= 1;
+            }
+        }
+
+        Remainder = High;
+        return Quotient;
+    }
+
+    // The loops below run on the low Length words of their arguments only.
+
+    // A += B, returns the carry out of the top word
+    static constexpr uint8_t AddWords(uint64_t A[], const uint64_t B[], size_t Length) noexcept {
+        uint8_t Carry = 0;
+        for (size_t i = 0; i < Length; ++i) {
+            Carry = AddWord(Carry, A[i], B[i], A[i]);
+        }
+        return Carry;
+    }
+
+    // A -= B, returns the borrow out of the top word
+    static constexpr uint8_t SubtractWords(uint64_t A[], const uint64_t B[], size_t Length) noexcept {
+        uint8_t Borrow = 0;
+        for (size_t i = 0; i < Length; ++i) {
+            Borrow = SubtractWord(Borrow, A[i], B[i], A[i]);
+        }
+        return Borrow;
+    }
+
+    // A += B * Word, returns the word carried out of the top one
+    static constexpr uint64_t MultiplyAddWords(uint64_t A[], const uint64_t B[], uint64_t Word, size_t Length) noexcept {
+        uint64_t Carry = 0;
+        for (size_t i = 0; i < Length; ++i) {
+            uint64_t High = 0;
+            uint64_t Low = MultiplyWord(B[i], Word, High);
+            High += AddWord(0, A[i], Low, A[i]);
+            High += AddWord(0, A[i], Carry, A[i]);
+            Carry = High;
+        }
+        return Carry;
+    }
+
+    [[nodiscard]]
+    static constexpr int CompareWords(const uint64_t A[], const uint64_t B[], size_t Length) noexcept {
+        for (size_t i = Length; i-- > 0;) {
+            if (A[i] != B[i]) {
+                return A[i] < B[i] ? -1 : 1;
+            }
+        }
+        return 0;
+    }
+
+    // A >>= Shift for 0 < Shift < 64
+    static constexpr void ShiftRightWords(uint64_t A[], unsigned Shift, size_t Length) noexcept {
+        for (size_t i = 0; i + 1 < Length; ++i) {
+            A[i] = A[i] >> Shift | A[i + 1] << (64 - Shift);
+        }
+        A[Length - 1] >>= Shift;
+    }
+
+    [[nodiscard]]
+    static constexpr bool IsZeroWords(const uint64_t A[], size_t Length) noexcept {
+        for (size_t i = 0; i < Length; ++i) {
+            if (A[i] != 0) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    [[nodiscard]]
+    static constexpr unsigned CountLeadingZeros(uint64_t Word) noexcept {
+#if defined(_M_X64) || defined(__x86_64__)
+        if (__builtin_is_constant_evaluated() == false && Word != 0) {
+#if defined(_MSC_VER)
+            unsigned long Index = 0;
+            _BitScanReverse64(&Index, Word);
+            return 63 - Index;
+#else
+            return static_cast<unsigned>(__builtin_clzll(Word));
+#endif
+        }
+#endif
+
+        unsigned Count = 0;
+        for (uint64_t Bit = uint64_t{1} << 63; Bit != 0 && (Word & Bit) == 0; Bit >>= 1) {
+            ++Count;
+        }
+        return Count;
+    }
+
+    [[nodiscard]]
+    static constexpr size_t BitLengthWords(const uint64_t A[], size_t Length) noexcept {
+        for (size_t i = Length; i-- > 0;) {
+            if (A[i] != 0) {
+                return i * 64 + 64 - CountLeadingZeros(A[i]);
+            }
+        }
+        return 0;
+    }
+
+    // The 64 bits of A from bit Offset on
+    [[nodiscard]]
+    static constexpr uint64_t ExtractWord(const uint64_t A[], size_t Offset, size_t Length) noexcept {
+        size_t i = Offset / 64;
+        unsigned Shift = Offset % 64;
+
+        uint64_t Word = i < Length ? A[i] >> Shift : 0;
+        if (Shift != 0 && i + 1 < Length) {
+            Word |= A[i + 1] << (64 - Shift);
+        }
+
+        return Word;
+    }
+
+    // f and g of f + g * 2 ^ 32 in two's complement, for |f|, |g| < 2 ^ 31
+    [[nodiscard]]
+    static constexpr int64_t UnpackLow(uint64_t Packed) noexcept {
+        return static_cast<int32_t>(static_cast<uint32_t>(Packed));
+    }
+
+    [[nodiscard]]
+    static constexpr int64_t UnpackHigh(uint64_t Packed) noexcept {
+        return static_cast<int32_t>(static_cast<uint32_t>((Packed - static_cast<uint64_t>(UnpackLow(Packed))) >> 32));
+    }
+
+    // Result = |A * F + B * G|, returns whether A * F + B * G is negative.
+    // Both products go word by word into one sum or difference, by their magnitudes.
+    static constexpr bool CombineWords(uint64_t Result[], const uint64_t A[], int64_t F, const uint64_t B[], int64_t G, size_t Length) noexcept {
+        uint64_t AbsF = F < 0 ? 0 - static_cast<uint64_t>(F) : static_cast<uint64_t>(F);
+        uint64_t AbsG = G < 0 ? 0 - static_cast<uint64_t>(G) : static_cast<uint64_t>(G);
+        bool IsDifference = (F < 0) != (G < 0);
+
+        uint64_t CarryA = 0, CarryB = 0;
+        uint8_t Carry = 0;
+
+        for (size_t i = 0; i < Length; ++i) {
+            uint64_t HighA = 0, HighB = 0;
+            uint64_t LowA = MultiplyWord(A[i], AbsF, HighA);
+            uint64_t LowB = MultiplyWord(B[i], AbsG, HighB);
+            HighA += AddWord(0, LowA, CarryA, LowA);
+            HighB += AddWord(0, LowB, CarryB, LowB);
+            CarryA = HighA;
+            CarryB = HighB;
+
+            Carry = IsDifference ? SubtractWord(Carry, LowA, LowB, Result[i]) : AddWord(Carry, LowA, LowB, Result[i]);
+        }
+
+        if (IsDifference == false || Carry == 0) {
+            return F < 0;
+        }
+
+        // B * |G| > A * |F|, so negate the difference.
+        uint8_t Borrow = 0;
+        for (size_t i = 0; i < Length; ++i) {
+            Borrow = SubtractWord(Borrow, 0, Result[i], Result[i]);
+        }
+        return G < 0;
+    }
+
+    // Result = -T / 2 ^ 30 mod M if IsNegative, or else T / 2 ^ 30 mod M, for T < 2 ^ 31 * M, by a Montgomery reduction
+    // where T + q * M = 0 mod 2 ^ 30 and (T + q * M) / 2 ^ 30 < 3 * M.
+    static constexpr void ReduceWords(uint64_t Result[], uint64_t T[], bool IsNegative, const uint64_t M[], uint64_t NegativeInverse, size_t Length) noexcept {
+        MultiplyAddWords(T, M, (T[0] * NegativeInverse) & 0x3fffffff, Length);
+        ShiftRightWords(T, 30, Length);
+
+        while (CompareWords(T, M, Length) >= 0) {
+            SubtractWords(T, M, Length);
+        }
+
+        if (IsNegative && IsZeroWords(T, Length) == false) {
+            for (size_t i = 0; i < Length; ++i) {
+                Result[i] = M[i];
+            }
+            SubtractWords(Result, T, Length);
+        } else {
+            for (size_t i = 0; i < Length; ++i) {
+                Result[i] = T[i];
+            }
+        }
+    }
+
+    // Quotient and Remainder of Dividend / Divisor, on 64-bit digits.
+    // Knuth. The Art of Computer Programming, Volume 2. Section 4.3.1, Algorithm D
+    static constexpr void DivideModulo(FixedUInt& Quotient, FixedUInt& Remainder, const FixedUInt& Dividend, const FixedUInt& Divisor) {
+        size_t n = WordCountValue;
+        while (n > 0 && Divisor.m_Words[n - 1] == 0) {
+            --n;
+        }
+
+        if (n == 0) {
+            throw std::invalid_argument("Division by zero.");
+        }
+
+        size_t m = WordCountValue;
+        while (m > 0 && Dividend.m_Words[m - 1] == 0) {
+            --m;
+        }
+
+        if (m < n) {
+            Quotient = FixedUInt();
+            Remainder = Dividend;
+            return;
+        }
+
+        uint64_t u[WordCountValue + 1] = {};
+        uint64_t v[WordCountValue] = {};
+        FixedUInt q, r;
+
+        if (n == 1) {
+            uint64_t Rest = 0;
+            for (size_t j = m; j-- > 0;) {
+                q.m_Words[j] = DivideWord(Rest, Dividend.m_Words[j], Divisor.m_Words[0], Rest);
+            }
+            r.m_Words[0] = Rest;
+        } else {
+            // D1. Normalize, so that the top bit of v is set and every trial quotient is 2 too large at most.
+            unsigned s = CountLeadingZeros(Divisor.m_Words[n - 1]);
+
+            for (size_t i = 0; i < n; ++i) {
+                v[i] = Divisor.m_Words[i];
+            }
+            for (size_t i = 0; i < m; ++i) {
+                u[i] = Dividend.m_Words[i];
+            }
+
+            if (s != 0) {
+                u[m] = u[m - 1] >> (64 - s);
+                for (size_t i = m; i-- > 1;) {
+                    u[i] = u[i] << s | u[i - 1] >> (64 - s);
+                }
+                u[0] <<= s;
+
+                for (size_t i = n; i-- > 1;) {
+                    v[i] = v[i] << s | v[i - 1] >> (64 - s);
+                }
+                v[0] <<= s;
+            }
+
+            for (size_t j = m - n + 1; j-- > 0;) {
+                // D3. qhat = (u[j + n] * 2^64 + u[j + n - 1]) / v[n - 1], corrected by the next digit
+                uint64_t qhat = 0, rhat = 0;
+                bool IsRhatLarge = false;
+
+                if (u[j + n] >= v[n - 1]) {
+                    qhat = ~uint64_t{0};
+                    IsRhatLarge = AddWord(0, u[j + n - 1], v[n - 1], rhat) != 0;
+                } else {
+                    qhat = DivideWord(u[j + n], u[j + n - 1], v[n - 1], rhat);
+                }
+
+                while (IsRhatLarge == false) {
+                    uint64_t High = 0;
+                    uint64_t Low = MultiplyWord(qhat, v[n - 2], High);
+                    if (High < rhat || (High == rhat && Low <= u[j + n - 2])) {
+                        break;
+                    }
+                    --qhat;
+                    IsRhatLarge = AddWord(0, rhat, v[n - 1], rhat) != 0;
+                }
+
+                // D4. u[j .. j + n] -= qhat * v
+                uint64_t Carry = 0;
+                uint8_t Borrow = 0;
+                for (size_t i = 0; i < n; ++i) {
+                    uint64_t High = 0;
+                    uint64_t Low = MultiplyWord(qhat, v[i], High);
+                    High += AddWord(0, Low, Carry, Low);
+                    Carry = High;
+                    Borrow = SubtractWord(Borrow, u[i + j], Low, u[i + j]);
+                }
+                Borrow = SubtractWord(Borrow, u[j + n], Carry, u[j + n]);
+
+                // D5, D6. qhat was 1 too large, which is rare, so add v back.
+                if (Borrow != 0) {
+                    --qhat;
+                    u[j + n] += AddWords(u + j, v, n);
+                }
+
+                q.m_Words[j] = qhat;
+            }
+
+            // D8. Unnormalize.
+            for (size_t i = 0; i < n; ++i) {
+                r.m_Words[i] = s != 0 ? u[i] >> s | u[i + 1] << (64 - s) : u[i];
+            }
+        }
+
+        Quotient = q;
+        Remainder = r;
+    }
+
+public:
+
+    constexpr FixedUInt() noexcept :
+        m_Words{} {}
+
+    // __IntegerType must be a integer type, i.e. char, int, unsigned long...
+    template<typename __IntegerType, std::enable_if_t<std::is_integral<__IntegerType>::value, int> = 0>
+    constexpr FixedUInt(__IntegerType SmallInteger) :
+        m_Words{}
+    {
+        if constexpr (std::is_signed<__IntegerType>::value) {
+            if (SmallInteger < 0) {
+                throw std::invalid_argument("FixedUInt cannot be negative.");
+            }
+        }
+
+        m_Words[0] = static_cast<uint64_t>(SmallInteger);
+    }
+
+    // Zero-extended or truncated
+    template<size_t __OtherBits>
+    explicit constexpr FixedUInt(const FixedUInt<__OtherBits>& Other) noexcept :
+        m_Words{}
+    {
+        for (size_t i = 0; i < WordCountValue && i < FixedUInt<__OtherBits>::WordCountValue; ++i) {
+            m_Words[i] = Other.m_Words[i];
+        }
+    }
+
+    // Throws if Value is negative or doesn't fit.
+    explicit FixedUInt(const BigInteger& Value) :
+        m_Words{}
+    {
+        if (Value.IsNegative()) {
+            throw std::invalid_argument("FixedUInt cannot be negative.");
+        }
+
+        Load(false, Value.DumpAbsoluteValue(BigIntegerEndian::Little), BigIntegerEndian::Little);
+    }
+
+    // The same strings as BigInteger's, e.g. "0x2def66c7f63c047c2e7af50b55e6". Throws if the value is negative or doesn't fit.
+    FixedUInt(const char* lpszValue) :
+        FixedUInt(BigInteger(lpszValue)) {}
+
+    FixedUInt(const std::string& szValue) :
+        FixedUInt(BigInteger(szValue)) {}
+
+    // IsNegative must be false. It is there for the same calls as BigInteger's.
+    FixedUInt(bool IsNegative, const void* lpBytes, size_t cbBytes, BigIntegerEndian Endian) :
+        m_Words{}
+    {
+        Load(IsNegative, lpBytes, cbBytes, Endian);
+    }
+
+    FixedUInt(bool IsNegative, const std::initializer_list<uint8_t>& Bytes, BigIntegerEndian Endian) :
+        m_Words{}
+    {
+        Load(IsNegative, Bytes.begin(), Bytes.size(), Endian);
+    }
+
+    FixedUInt(bool IsNegative, const std::vector<uint8_t>& Bytes, BigIntegerEndian Endian) :
+        m_Words{}
+    {
+        Load(IsNegative, Bytes.data(), Bytes.size(), Endian);
+    }
+
+    [[nodiscard]]
+    constexpr bool operator==(const FixedUInt& Other) const noexcept {
+        for (size_t i = 0; i < WordCountValue; ++i) {
+            if (m_Words[i] != Other.m_Words[i]) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    [[nodiscard]]
+    constexpr bool operator!=(const FixedUInt& Other) const noexcept {
+        return !(*this == Other);
+    }
+
+    [[nodiscard]]
+    constexpr bool operator<(const FixedUInt& Other) const noexcept {
+        for (size_t i = WordCountValue; i-- > 0;) {
+            if (m_Words[i] != Other.m_Words[i]) {
+                return m_Words[i] < Other.m_Words[i];
+            }
+        }
+        return false;
+    }
+
+    [[nodiscard]]
+    constexpr bool operator<=(const FixedUInt& Other) const noexcept {
+        return !(Other < *this);
+    }
+
+    [[nodiscard]]
+    constexpr bool operator>(const FixedUInt& Other) const noexcept {
+        return Other < *this;
+    }
+
+    [[nodiscard]]
+    constexpr bool operator>=(const FixedUInt& Other) const noexcept {
+        return !(*this < Other);
+    }
+
+    [[nodiscard]]
+    constexpr FixedUInt operator+(const FixedUInt& Other) const noexcept {
+        FixedUInt Result(*this);
+        AddWords(Result.m_Words, Other.m_Words, WordCountValue);
+        return Result;
+    }
+
+    constexpr FixedUInt& operator+=(const FixedUInt& Other) noexcept {
+        AddWords(m_Words, Other.m_Words, WordCountValue);
+        return *this;
+    }
+
+    [[nodiscard]]
+    constexpr FixedUInt operator-(const FixedUInt& Other) const noexcept {
+        FixedUInt Result(*this);
+        SubtractWords(Result.m_Words, Other.m_Words, WordCountValue);
+        return Result;
+    }
+
+    constexpr FixedUInt& operator-=(const FixedUInt& Other) noexcept {
+        SubtractWords(m_Words, Other.m_Words, WordCountValue);
+        return *this;
+    }
+
+    // The product mod 2 ^ __Bits, i.e. the words A[i] * B[j] with i + j < WordCountValue only
+    [[nodiscard]]
+    constexpr FixedUInt operator*(const FixedUInt& Other) const noexcept {
+        FixedUInt Result;
+
+        for (size_t i = 0; i < WordCountValue; ++i) {
+            uint64_t Carry = 0;
+            for (size_t j = 0; i + j < WordCountValue; ++j) {
+                uint64_t High = 0;
+                uint64_t Low = MultiplyWord(m_Words[i], Other.m_Words[j], High);
+                High += AddWord(0, Result.m_Words[i + j], Low, Result.m_Words[i + j]);
+                High += AddWord(0, Result.m_Words[i + j], Carry, Result.m_Words[i + j]);
+                Carry = High;
+            }
+        }
+
+        return Result;
+    }
+
+    constexpr FixedUInt& operator*=(const FixedUInt& Other) noexcept {
+        return *this = *this * Other;
+    }
+
+    // The full product, of 2 * __Bits bits
+    [[nodiscard]]
+    constexpr FixedUInt<2 * __Bits> MultiplyWideValue(const FixedUInt& Other) const noexcept {
+        FixedUInt<2 * __Bits> Result;
+
+        for (size_t i = 0; i < WordCountValue; ++i) {
+            uint64_t Carry = 0;
+            for (size_t j = 0; j < WordCountValue; ++j) {
+                uint64_t High = 0;
+                uint64_t Low = MultiplyWord(m_Words[i], Other.m_Words[j], High);
+                High += AddWord(0, Result.m_Words[i + j], Low, Result.m_Words[i + j]);
+                High += AddWord(0, Result.m_Words[i + j], Carry, Result.m_Words[i + j]);
+                Carry = High;
+            }
+            Result.m_Words[i + WordCountValue] = Carry;
+        }
+
+        return Result;
+    }
+
+    [[nodiscard]]
+    constexpr FixedUInt operator/(const FixedUInt& Other) const {
+        FixedUInt Quotient, Remainder;
+        DivideModulo(Quotient, Remainder, *this, Other);
+        return Quotient;
+    }
+
+    constexpr FixedUInt& operator/=(const FixedUInt& Other) {
+        return *this = *this / Other;
+    }
+
+    [[nodiscard]]
+    constexpr FixedUInt operator%(const FixedUInt& Other) const {
+        FixedUInt Quotient, Remainder;
+        DivideModulo(Quotient, Remainder, *this, Other);
+        return Remainder;
+    }
+
+    constexpr FixedUInt& operator%=(const FixedUInt& Other) {
+        return *this = *this % Other;
+    }
+
+    [[nodiscard]]
+    constexpr FixedUInt operator<<(size_t Shift) const noexcept {
+        FixedUInt Result(*this);
+        return Result <<= Shift;
+    }
+
+    constexpr FixedUInt& operator<<=(size_t Shift) noexcept {
+        size_t WordShift = Shift / 64;
+        unsigned BitShift = Shift % 64;
+
+        for (size_t i = WordCountValue; i-- > 0;) {
+            uint64_t Word = 0;
+            if (i >= WordShift) {
+                Word = m_Words[i - WordShift] << BitShift;
+                if (BitShift != 0 && i > WordShift) {
+                    Word |= m_Words[i - WordShift - 1] >> (64 - BitShift);
+                }
+            }
+            m_Words[i] = Word;
+        }
+
+        return *this;
+    }
+
+    [[nodiscard]]
+    constexpr FixedUInt operator>>(size_t Shift) const noexcept {
+        FixedUInt Result(*this);
+        return Result >>= Shift;
+    }
+
+    constexpr FixedUInt& operator>>=(size_t Shift) noexcept {
+        size_t WordShift = Shift / 64;
+        unsigned BitShift = Shift % 64;
+
+        for (size_t i = 0; i < WordCountValue; ++i) {
+            uint64_t Word = 0;
+            if (i + WordShift < WordCountValue) {
+                Word = m_Words[i + WordShift] >> BitShift;
+                if (BitShift != 0 && i + WordShift + 1 < WordCountValue) {
+                    Word |= m_Words[i + WordShift + 1] << (64 - BitShift);
+                }
+            }
+            m_Words[i] = Word;
+        }
+
+        return *this;
+    }
+
+    [[nodiscard]]
+    constexpr FixedUInt operator~() const noexcept {
+        FixedUInt Result;
+        for (size_t i = 0; i < WordCountValue; ++i) {
+            Result.m_Words[i] = ~m_Words[i];
+        }
+        return Result;
+    }
+
+    [[nodiscard]]
+    constexpr FixedUInt operator&(const FixedUInt& Other) const noexcept {
+        FixedUInt Result(*this);
+        return Result &= Other;
+    }
+
+    constexpr FixedUInt& operator&=(const FixedUInt& Other) noexcept {
+        for (size_t i = 0; i < WordCountValue; ++i) {
+            m_Words[i] &= Other.m_Words[i];
+        }
+        return *this;
+    }
+
+    [[nodiscard]]
+    constexpr FixedUInt operator|(const FixedUInt& Other) const noexcept {
+        FixedUInt Result(*this);
+        return Result |= Other;
+    }
+
+    constexpr FixedUInt& operator|=(const FixedUInt& Other) noexcept {
+        for (size_t i = 0; i < WordCountValue; ++i) {
+            m_Words[i] |= Other.m_Words[i];
+        }
+        return *this;
+    }
+
+    [[nodiscard]]
+    constexpr FixedUInt operator^(const FixedUInt& Other) const noexcept {
+        FixedUInt Result(*this);
+        return Result ^= Other;
+    }
+
+    constexpr FixedUInt& operator^=(const FixedUInt& Other) noexcept {
+        for (size_t i = 0; i < WordCountValue; ++i) {
+            m_Words[i] ^= Other.m_Words[i];
+        }
+        return *this;
+    }
+
+    constexpr FixedUInt& operator++() noexcept {
+        return *this += FixedUInt(1u);
+    }
+
+    constexpr FixedUInt operator++(int) noexcept {
+        FixedUInt Result(*this);
+        ++*this;
+        return Result;
+    }
+
+    constexpr FixedUInt& operator--() noexcept {
+        return *this -= FixedUInt(1u);
+    }
+
+    constexpr FixedUInt operator--(int) noexcept {
+        FixedUInt Result(*this);
+        --*this;
+        return Result;
+    }
+
+    [[nodiscard]]
+    constexpr bool IsZero() const noexcept {
+        return *this == FixedUInt();
+    }
+
+    [[nodiscard]]
+    constexpr bool IsPositive() const noexcept {
+        return IsZero() == false;
+    }
+
+    [[nodiscard]]
+    constexpr bool IsNegative() const noexcept {
+        return false;
+    }
+
+    [[nodiscard]]
+    constexpr bool IsOne() const noexcept {
+        return *this == FixedUInt(1u);
+    }
+
+    // *this * Other mod N through the full product
+    [[nodiscard]]
+    constexpr FixedUInt MultiplyModValue(const FixedUInt& Other, const FixedUInt& N) const {
+        return FixedUInt(MultiplyWideValue(Other) % FixedUInt<2 * __Bits>(N));
+    }
+
+    // *this ^ -1 mod N for an odd N, by the binary GCD
+    //     a = *this, b = N, and while a != 0: a /= 2 if a is even, or else swap a and b if a < b, then a = (a - b) / 2,
+    // where 30 steps at a time run on 62-bit approximations of a and b, made of their low 30 and top 32 bits, and are then applied
+    // to the full values as a 2 x 2 matrix. The coefficients u and v with a = u * *this and b = v * *this mod N follow by the same
+    // matrix and a Montgomery reduction for the division by 2 ^ 30. Everything runs on the words of N only.
+    // Pornin. Optimized Binary GCD for Modular Inversion. IACR ePrint 2020/972, Algorithm 2
+    [[nodiscard]]
+    constexpr FixedUInt InverseModValue(const FixedUInt& N) const {
+        if (N.IsZero() || N.IsOne()) {
+            throw std::invalid_argument("N must be greater than 1");
+        }
+
+        if (N.TestBit(0) == false) {
+            throw std::invalid_argument("N must be odd.");
+        }
+
+        // one word more than N, for 2 ^ 32 * N at most in `CombineWords` and `ReduceWords`
+        size_t Length = (N.BitLength() + 63) / 64 + 1;
+
+        uint64_t m[WordCountValue + 1] = {};
+        uint64_t a[WordCountValue + 1] = {};
+        uint64_t b[WordCountValue + 1] = {};
+        uint64_t u[WordCountValue + 1] = {};
+        uint64_t v[WordCountValue + 1] = {};
+
+        FixedUInt y = *this < N ? *this : *this % N;
+        for (size_t i = 0; i < WordCountValue; ++i) {
+            m[i] = N.m_Words[i];
+            a[i] = y.m_Words[i];
+            b[i] = N.m_Words[i];
+        }
+        u[0] = 1;
+
+        // -N ^ -1 mod 2 ^ 64 by Newton's iteration, where N * N = 1 mod 8 makes 3 bits to start with, doubled every time
+        uint64_t NegativeInverse = m[0];
+        for (unsigned i = 0; i < 5; ++i) {
+            NegativeInverse *= 2 - m[0] * NegativeInverse;
+        }
+        NegativeInverse = 0 - NegativeInverse;
+
+        while (IsZeroWords(a, Length) == false) {
+            size_t n = std::max<size_t>(std::max(BitLengthWords(a, Length), BitLengthWords(b, Length)), 62);
+
+            uint64_t ah = (a[0] & 0x3fffffff) | ExtractWord(a, n - 32, Length) << 30;
+            uint64_t bh = (b[0] & 0x3fffffff) | ExtractWord(b, n - 32, Length) << 30;
+
+            // A step on an odd a takes a = |a - b| / 2 and b = min(a, b) without a branch, which would be mispredicted half of the time.
+            // (f, g) is packed into one word as f + g * 2 ^ 32 in two's complement, as the steps are linear in it,
+            // and |f|, |g| <= 2 ^ 30 after 30 of them.
+            uint64_t fg0 = 1, fg1 = uint64_t{1} << 32;
+
+            for (unsigned i = 0; i < 30; ++i) {
+                uint64_t IsOdd = 0 - (ah & 1);
+                uint64_t IsLess = 0 - static_cast<uint64_t>(ah < bh);
+                uint64_t IsSwapped = IsOdd & IsLess;
+
+                uint64_t Difference = ah < bh ? bh - ah : ah - bh;
+                bh ^= (ah ^ bh) & IsSwapped;
+                ah = (ah & 1) != 0 ? Difference : ah;
+
+                uint64_t t = (fg0 ^ fg1) & IsSwapped;
+                fg0 ^= t;
+                fg1 ^= t;
+
+                fg0 -= fg1 & IsOdd;
+
+                ah >>= 1;
+                fg1 <<= 1;
+            }
+
+            int64_t F0 = UnpackLow(fg0), G0 = UnpackHigh(fg0);
+            int64_t F1 = UnpackLow(fg1), G1 = UnpackHigh(fg1);
+
+            uint64_t T0[WordCountValue + 1] = {};
+            uint64_t T1[WordCountValue + 1] = {};
+
+            // a = |a * f0 + b * g0| / 2 ^ 30, which may come out negative as the approximations go wrong near the end,
+            // and then its sign goes into (f0, g0). The same for b.
+            if (CombineWords(T0, a, F0, b, G0, Length)) {
+                F0 = -F0;
+                G0 = -G0;
+            }
+
+            if (CombineWords(T1, a, F1, b, G1, Length)) {
+                F1 = -F1;
+                G1 = -G1;
+            }
+
+            ShiftRightWords(T0, 30, Length);
+            ShiftRightWords(T1, 30, Length);
+
+            for (size_t i = 0; i < Length; ++i) {
+                a[i] = T0[i];
+                b[i] = T1[i];
+            }
+
+            // u = (u * f0 + v * g0) / 2 ^ 30 mod N, the same for v
+            bool IsNegativeU = CombineWords(T0, u, F0, v, G0, Length);
+            bool IsNegativeV = CombineWords(T1, u, F1, v, G1, Length);
+
+            ReduceWords(u, T0, IsNegativeU, m, NegativeInverse, Length);
+            ReduceWords(v, T1, IsNegativeV, m, NegativeInverse, Length);
+        }
+
+        // b = gcd(*this, N)
+        if (b[0] != 1 || IsZeroWords(b + 1, Length - 1) == false) {
+            throw std::invalid_argument("Not invertible.");
+        }
+
+        FixedUInt Result;
+        for (size_t i = 0; i < WordCountValue; ++i) {
+            Result.m_Words[i] = v[i];
+        }
+
+        return Result;
+    }
+
+    constexpr FixedUInt& InverseMod(const FixedUInt& N) {
+        return *this = InverseModValue(N);
+    }
+
+    // Throws if IsNegative is true or the value doesn't fit.
+    FixedUInt& Load(bool IsNegative, const void* lpBytes, size_t cbBytes, BigIntegerEndian Endian) {
+        if (IsNegative) {
+            throw std::invalid_argument("FixedUInt cannot be negative.");
+        }
+
+        auto pbBytes = reinterpret_cast<const uint8_t*>(lpBytes);
+
+        *this = FixedUInt();
+
+        for (size_t i = 0; i < cbBytes; ++i) {
+            uint8_t Byte = pbBytes[Endian == BigIntegerEndian::Little ? i : cbBytes - 1 - i];
+            if (i < __Bits / 8) {
+                m_Words[i / 8] |= uint64_t{Byte} << (i % 8 * 8);
+            } else if (Byte != 0) {
+                throw std::length_error("Value is too large.");
+            }
+        }
+
+        return *this;
+    }
+
+    FixedUInt& Load(bool IsNegative, const std::initializer_list<uint8_t>& Bytes, BigIntegerEndian Endian) {
+        return Load(IsNegative, Bytes.begin(), Bytes.size(), Endian);
+    }
+
+    FixedUInt& Load(bool IsNegative, const std::vector<uint8_t>& Bytes, BigIntegerEndian Endian) {
+        return Load(IsNegative, Bytes.data(), Bytes.size(), Endian);
+    }
+
+    // The same bytes as BigInteger's, where 0 takes one byte.
+    void DumpAbsoluteValue(void* lpBuffer, size_t cbBuffer, BigIntegerEndian Endian) const {
+        size_t StorageSize = IsZero() ? 1 : (BitLength() + 7) / 8;
+
+        if (cbBuffer < StorageSize) {
+            throw std::length_error("Insufficient buffer.");
+        }
+
+        auto pbBuffer = reinterpret_cast<uint8_t*>(lpBuffer);
+
+        for (size_t i = 0; i < cbBuffer; ++i) {
+            uint8_t Byte = i < __Bits / 8 ? static_cast<uint8_t>(m_Words[i / 8] >> (i % 8 * 8)) : 0;
+            if (Endian == BigIntegerEndian::Little) {
+                pbBuffer[i] = Byte;
+            } else if (i < StorageSize) {
+                pbBuffer[StorageSize - 1 - i] = Byte;
+            } else {
+                pbBuffer[i] = 0;
+            }
+        }
+    }
+
+    [[nodiscard]]
+    std::vector<uint8_t> DumpAbsoluteValue(BigIntegerEndian Endian) const noexcept {
+        std::vector<uint8_t> Bytes(IsZero() ? 1 : (BitLength() + 7) / 8);
+        DumpAbsoluteValue(Bytes.data(), Bytes.size(), Endian);
+        return Bytes;
+    }
+
+    // 0 for 0, unlike BigInteger's 1
+    [[nodiscard]]
+    constexpr size_t BitLength() const noexcept {
+        for (size_t i = WordCountValue; i-- > 0;) {
+            if (m_Words[i] != 0) {
+                return i * 64 + 64 - CountLeadingZeros(m_Words[i]);
+            }
+        }
+        return 0;
+    }
+
+    [[nodiscard]]
+    constexpr bool TestBit(size_t i) const noexcept {
+        return i < __Bits && (m_Words[i / 64] >> (i % 64) & 1) != 0;
+    }
+
+    constexpr void SetBit(size_t i) noexcept {
+        m_Words[i / 64] |= uint64_t{1} << (i % 64);
+    }
+
+    // The value as __IntegerType, which it must fit in.
+    template<typename __IntegerType>
+    [[nodiscard]]
+    constexpr __IntegerType ToInteger() const noexcept {
+        static_assert(std::is_integral<__IntegerType>::value);
+        return static_cast<__IntegerType>(m_Words[0]);
+    }
+
+    [[nodiscard]]
+    BigInteger ToBigInteger() const noexcept {
+        uint8_t Bytes[__Bits / 8];
+        DumpAbsoluteValue(Bytes, sizeof(Bytes), BigIntegerEndian::Little);
+        return BigInteger(false, Bytes, sizeof(Bytes), BigIntegerEndian::Little);
+    }
+
+    [[nodiscard]]
+    std::string ToString(size_t Base, bool LowerCase = false) const {
+        return ToBigInteger().ToString(Base, LowerCase);
+    }
+};
+
+// N as a BigInteger, for code templated on the integer type where a step still needs BigInteger.
+// A BigInteger is passed through without a copy.
+[[nodiscard]]
+inline const BigInteger& ToBigInteger(const BigInteger& N) noexcept {
+    return N;
+}
+
+template<size_t __Bits>
+[[nodiscard]]
+BigInteger ToBigInteger(const FixedUInt<__Bits>& N) noexcept {
+    return N.ToBigInteger();
+}
@@ -30,6 +30,9 @@ private:
 
 public:
 
+    static constexpr size_t BinaryBitSizeValue = __FieldTraits::BinaryBitSizeValue;
+    static constexpr size_t BinaryByteSizeValue = __FieldTraits::BinaryByteSizeValue;
+
     GaloisField() noexcept {
         __FieldTraits::SetZero(m_Value);
     }
@@ -131,6 +134,33 @@ public:
         return *this;
     }
 
+    // A multiplier which is prepared once and then used in many multiplications.
+    class Prepared {
+    private:
+
+        friend class GaloisField;
+
+        typename __FieldTraits::PreparedType m_Value;
+
+    public:
+
+        explicit Prepared(const GaloisField& Multiplier) noexcept {
+            __FieldTraits::Prepare(m_Value, Multiplier.m_Value);
+        }
+    };
+
+    GaloisField& MultiplyBy(const Prepared& Other) noexcept {
+        __FieldTraits::MultiplyPreparedAssign(m_Value, Other.m_Value);
+        return *this;
+    }
+
+    [[nodiscard]]
+    GaloisField MultiplyByValue(const Prepared& Other) const noexcept {
+        GaloisField Result(nullptr);
+        __FieldTraits::MultiplyPrepared(Result.m_Value, m_Value, Other.m_Value);
+        return Result;
+    }
+
     [[nodiscard]]
     GaloisField operator/(const GaloisField& Other) const {
         GaloisField Result(nullptr);
@@ -275,18 +305,77 @@ public:
         return GaloisField(GaloisFieldInitByOne{});
     }
 
+    // Results[i] = As[i] * Bs[i]    where 0 <= i < Count
+    static void MultiplyN(GaloisField Results[], const GaloisField As[], const GaloisField Bs[], size_t Count) noexcept {
+        static_assert(sizeof(GaloisField) == sizeof(ElementType));
+        __FieldTraits::MultiplyN(
+            reinterpret_cast<ElementType*>(Results),
+            reinterpret_cast<const ElementType*>(As),
+            reinterpret_cast<const ElementType*>(Bs),
+            Count
+        );
+    }
+
+    // Results[i] = As[i] ^ 2    where 0 <= i < Count
+    static void SquareN(GaloisField Results[], const GaloisField As[], size_t Count) noexcept {
+        static_assert(sizeof(GaloisField) == sizeof(ElementType));
+        __FieldTraits::SquareN(
+            reinterpret_cast<ElementType*>(Results),
+            reinterpret_cast<const ElementType*>(As),
+            Count
+        );
+    }
+
+    // Results[i] = As[i] ^ -1    where 0 <= i < Count
+    static void InverseN(GaloisField Results[], const GaloisField As[], size_t Count) {
+        static_assert(sizeof(GaloisField) == sizeof(ElementType));
+        __FieldTraits::InverseN(
+            reinterpret_cast<ElementType*>(Results),
+            reinterpret_cast<const ElementType*>(As),
+            Count
+        );
+    }
+
+    // Results[i] = As[i] ^ -1    where 0 <= i < Count
+    // Only one inversion is done for the whole batch, zero elements stay zero.
+    static void BatchInverse(GaloisField Results[], const GaloisField As[], size_t Count) {
+        static_assert(sizeof(GaloisField) == sizeof(ElementType));
+        __FieldTraits::BatchInverse(
+            reinterpret_cast<ElementType*>(Results),
+            reinterpret_cast<const ElementType*>(As),
+            Count
+        );
+    }
+
+    // Elements[i] = Elements[i] ^ -1    where 0 <= i < Count
+    static void BatchInverse(GaloisField Elements[], size_t Count) {
+        BatchInverse(Elements, Elements, Count);
+    }
+
+    // Solve "z^2 + z = Beta", the other root is z + 1.
+    // False is returned if there is no root, i.e. Tr(Beta) = 1. Nothing is inverted.
+    static bool SolveQuadratic(GaloisField& Root, const GaloisField& Beta) {
+        return __FieldTraits::SolveQuadratic(Root.m_Value, Beta.m_Value);
+    }
+
     // Solve "A * x^2 + B * x + C = 0"
-    static std::vector<GaloisField> SolveQuadratic(const GaloisField& A, const GaloisField& B, const GaloisField& C) {
-        std::vector<GaloisField> Roots;
-        std::vector<ElementType> roots = __FieldTraits::SolveQuadratic(A.m_Value, B.m_Value, C.m_Value);
+    // Roots are written to `Roots`, and the number of roots is returned. Nothing is allocated.
+    static size_t SolveQuadratic(GaloisField (&Roots)[2], const GaloisField& A, const GaloisField& B, const GaloisField& C) {
+        ElementType roots[2];
+        size_t RootCount = __FieldTraits::SolveQuadratic(roots, A.m_Value, B.m_Value, C.m_Value);
 
-        for (size_t i = 0; i < roots.size(); ++i) {
-            Roots.emplace_back(
-                GaloisField(std::move(roots[i]))
-            );
+        for (size_t i = 0; i < RootCount; ++i) {
+            Roots[i].m_Value = roots[i];
         }
 
-        return Roots;
+        return RootCount;
+    }
+
+    // Solve "A * x^2 + B * x + C = 0"
+    static std::vector<GaloisField> SolveQuadratic(const GaloisField& A, const GaloisField& B, const GaloisField& C) {
+        GaloisField Roots[2];
+        size_t RootCount = SolveQuadratic(Roots, A, B, C);
+        return std::vector<GaloisField>(Roots, Roots + RootCount);
     }
 };
 
@@ -1,4 +1,5 @@
 #pragma once
+#include <stddef.h>
 #include <utility>
 
 template<typename __HashTraits>
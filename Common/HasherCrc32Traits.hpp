@@ -2,6 +2,7 @@
 #include <stddef.h>
 #include <stdint.h>
 #include <vector>
+#include "VisualAssistDispatch.hpp"
 
 template<uint32_t __Polynomial>
 struct HasherCrc32Traits {
@@ -96,29 +97,7 @@ struct HasherCrc32Traits {
     };
 };
 
-#ifdef _MSC_VER
-#include <windows.h>
-
-#ifdef __cplusplus
-extern "C" {
-#endif
-
-#pragma comment(lib, "ntdll")
-
-    // available on WindowsXP and above
-    NTSYSAPI
-    DWORD
-    NTAPI
-    RtlComputeCrc32(
-        _In_ DWORD InitialCrc,
-        _In_reads_bytes_(Size) const void* Buffer,
-        _In_ size_t Size
-    );
-
-#ifdef __cplusplus
-}
-#endif
-
+// Standard CRC-32, by table or by carry-less multiplication, see `VisualAssistDispatch`.
 template<>
 struct HasherCrc32Traits<0xEDB88320> {
     static constexpr size_t DigestSizeValue = 32 / 8;
@@ -134,7 +113,7 @@ struct HasherCrc32Traits<0xEDB88320> {
         }
 
         void Initialize(uint32_t InitialVal) noexcept {
-            InitialVal = InitialVal;
+            InitialValue = InitialVal;
             Reset();
         }
 
@@ -143,7 +122,7 @@ struct HasherCrc32Traits<0xEDB88320> {
         }
 
         void Update(const void* lpData, size_t cbData) noexcept {
-            Value = RtlComputeCrc32(Value, lpData, cbData);
+            Value = ~VisualAssistDispatch::Get().Crc32.Update(~Value, lpData, cbData);
         }
 
         void Evaluate(void* lpDigest) const noexcept {
@@ -180,5 +159,3 @@ struct HasherCrc32Traits<0xEDB88320> {
     };
 };
 
-#endif  // #ifdef _MSC_VER
-
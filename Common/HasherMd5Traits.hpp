@@ -5,6 +5,7 @@
 #include <vector>
 #include <utility>
 #include <type_traits>
+#include "Intrinsics.hpp"
 
 struct HasherMd5Traits {
 public:
@@ -108,15 +109,18 @@ private:
             (LoopIteration<__Indexes>(A, B, C, D, MessageBlock), ...);
         }
 
-        // lpData must be aligned to 4 bytes.
-        // Otherwise, it would cause performance degradation.
+        // lpData may have any alignment. Words are little endian, as x86 is, and are copied out by memcpy,
+        // which compiles to plain loads, since reading the bytes through a uint32_t lvalue would break strict aliasing.
         static void ProcessBlock(uint32_t State[4], const void* lpData) noexcept {
+            BlockType MessageBlock;
+            memcpy(MessageBlock, lpData, sizeof(MessageBlock));
+
             uint32_t AA = State[0];
             uint32_t BB = State[1];
             uint32_t CC = State[2];
             uint32_t DD = State[3];
 
-            Loop(AA, BB, CC, DD, *reinterpret_cast<const BlockType*>(lpData), std::make_index_sequence<64>{});
+            Loop(AA, BB, CC, DD, MessageBlock, std::make_index_sequence<64>{});
 
             State[0] += AA;
             State[1] += BB;
@@ -131,7 +135,7 @@ public:
         uint32_t InitialState[4];
         uint32_t State[4];
         uint64_t BytesRead;
-        alignas(uint32_t) uint8_t MessageQueue[BlockSizeValue];
+        uint8_t MessageQueue[BlockSizeValue];
 
         void Initialize() noexcept {
             InitialState[0] = 0x67452301u;
@@ -182,23 +186,11 @@ public:
                     BytesRead += BytesToRead;
                 }
 
-                if (reinterpret_cast<uintptr_t>(pbData) % sizeof(uint32_t) == 0) {
-                    // In this case, pbData is aligned to 4 bytes.
-                    // We can just process it in place.
-                    while (cbData >= BlockSizeValue) {
-                        Utility::ProcessBlock(State, pbData);
-                        pbData += BlockSizeValue;
-                        cbData -= BlockSizeValue;
-                        BytesRead += BlockSizeValue;
-                    }
-                } else {
-                    while (cbData >= BlockSizeValue) {
-                        memcpy(MessageQueue, pbData, BlockSizeValue);
-                        Utility::ProcessBlock(State, MessageQueue);
-                        pbData += BlockSizeValue;
-                        cbData -= BlockSizeValue;
-                        BytesRead += BlockSizeValue;
-                    }
+                while (cbData >= BlockSizeValue) {
+                    Utility::ProcessBlock(State, pbData);
+                    pbData += BlockSizeValue;
+                    cbData -= BlockSizeValue;
+                    BytesRead += BlockSizeValue;
                 }
 
                 if (cbData) {
@@ -212,21 +204,18 @@ public:
             uint32_t ForkedState[4];
             memcpy(ForkedState, State, sizeof(ForkedState));
 
-            alignas(uint32_t) uint8_t PaddedTailData[2 * BlockSizeValue] = {};
+            uint8_t PaddedTailData[2 * BlockSizeValue] = {};
             size_t MessageQueueLength = BytesRead % BlockSizeValue;
+            uint64_t BitLength = BytesRead * 8;
 
             memcpy(PaddedTailData, MessageQueue, MessageQueueLength);
             PaddedTailData[MessageQueueLength] = 0x80;
             if (MessageQueueLength >= BlockSizeValue - sizeof(uint64_t)) {
-                reinterpret_cast<uint64_t*>(
-                    PaddedTailData + 2 * BlockSizeValue - sizeof(uint64_t)
-                    )[0] = BytesRead * 8;
+                memcpy(PaddedTailData + 2 * BlockSizeValue - sizeof(uint64_t), &BitLength, sizeof(BitLength));
                 Utility::ProcessBlock(ForkedState, PaddedTailData);
                 Utility::ProcessBlock(ForkedState, PaddedTailData + BlockSizeValue);
             } else {
-                reinterpret_cast<uint64_t*>(
-                    PaddedTailData + BlockSizeValue - sizeof(uint64_t)
-                    )[0] = BytesRead * 8;
+                memcpy(PaddedTailData + BlockSizeValue - sizeof(uint64_t), &BitLength, sizeof(BitLength));
                 Utility::ProcessBlock(ForkedState, PaddedTailData);
             }
 
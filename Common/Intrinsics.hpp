@@ -0,0 +1,9 @@
+#pragma once
+
+// x86 intrinsics, including `_rotl` and `_rotr`.
+// MSVC puts all of them in <intrin.h>, GCC and Clang in <x86intrin.h>.
+#if defined(_MSC_VER)
+#include <intrin.h>
+#else
+#include <x86intrin.h>
+#endif
@@ -0,0 +1,689 @@
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+#include <memory.h>
+#include <memory>
+#include <vector>
+#include <stdexcept>
+#include "Intrinsics.hpp"
+
+// Multiplication table of optimal normal basis beta_i = beta ^ (2 ^ i), 0 <= i < M, of GF(2^M), where
+//     type 1:    p = M + 1 is prime, 2 is primitive modulo p, and beta = gamma
+//     type 2:    p = 2 * M + 1 is prime, 2 or -2 is primitive modulo p, and beta = gamma + gamma ^ -1
+// with gamma a primitive p-th root of unity in GF(2^(T * M)).
+//
+// Row i lists the j for which beta_0 appears in beta_i * beta_j. Row 0 has one entry, and the others have two, so
+//     c_k = sum(a_(k + i) * (b_(k + T0[i]) + b_(k + T1[i])))    where indexes are taken modulo M, and T1[0] is not used.
+// Since beta_i * beta_j is a sum of gamma ^ (+-2 ^ i +- 2 ^ j), the entries follow from powers of 2 modulo p alone.
+template<size_t __M, size_t __Type>
+struct OnbMultiplicationTable {
+    static_assert(__Type == 1 || __Type == 2, "Only type 1 and type 2 normal bases are optimal.");
+
+    static constexpr size_t P = __Type * __M + 1;
+
+    struct TableType {
+        uint16_t T0[__M];
+        uint16_t T1[__M];
+    };
+
+    // Entries[e] = k    if 2 ^ k = e (mod p) for type 1, or 2 ^ k = +-e (mod p) for type 2
+    // Entries[e] = M    if there is no such k, e.g. e = 0
+    struct ExponentTableType {
+        uint16_t Entries[P];
+    };
+
+    static constexpr ExponentTableType GenerateExponentTable() noexcept {
+        ExponentTableType Table = {};
+
+        for (size_t e = 0; e < P; ++e) {
+            Table.Entries[e] = static_cast<uint16_t>(__M);
+        }
+
+        for (size_t k = 0, e = 1; k < __M; ++k, e = e * 2 % P) {
+            Table.Entries[e] = static_cast<uint16_t>(k);
+            if constexpr (__Type == 2) {
+                Table.Entries[P - e] = static_cast<uint16_t>(k);
+            }
+        }
+
+        return Table;
+    }
+
+    // p is prime, and every unit modulo p is reached by `GenerateExponentTable`
+    static constexpr bool IsOptimalNormalBasis() noexcept {
+        for (size_t d = 2; d * d <= P; ++d) {
+            if (P % d == 0) {
+                return false;
+            }
+        }
+
+        ExponentTableType Exponent = GenerateExponentTable();
+        for (size_t e = 1; e < P; ++e) {
+            if (Exponent.Entries[e] == __M) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    static constexpr TableType Generate() noexcept {
+        TableType Table = {};
+        ExponentTableType Exponent = GenerateExponentTable();
+
+        for (size_t i = 0, e = 1; i < __M; ++i, e = e * 2 % P) {
+            size_t t0 = __M;
+            size_t t1 = __M;
+
+            if constexpr (__Type == 1) {
+                t0 = Exponent.Entries[P - e];           // 2 ^ i + 2 ^ j = 0, beta_i * beta_j = 1 = sum(beta_k)
+                t1 = Exponent.Entries[(P + 1 - e) % P]; // 2 ^ i + 2 ^ j = 1
+            } else {
+                t0 = Exponent.Entries[(e + 1) % P];     // 2 ^ i - 2 ^ j = -1 or 2 ^ i + 2 ^ j = -1
+                t1 = Exponent.Entries[(e + P - 1) % P]; // 2 ^ i - 2 ^ j = 1 or 2 ^ i + 2 ^ j = 1
+            }
+
+            if (t1 == __M) {
+                Table.T0[i] = static_cast<uint16_t>(t0);
+                Table.T1[i] = 0;
+            } else {
+                Table.T0[i] = static_cast<uint16_t>(t0 < t1 ? t0 : t1);
+                Table.T1[i] = static_cast<uint16_t>(t0 < t1 ? t1 : t0);
+            }
+        }
+
+        return Table;
+    }
+};
+
+// GF(2^M) with respect to type 1 or type 2 ONB, by the same algorithms as `VisualAssistFieldTraits`:
+//     1. multiplication by Ning-Yin's algorithm, with `T0` and `T1` generated at compile time,
+//     2. inversion by Itoh-Tsujii, with rotations for the squarings,
+//     3. z ^ 2 + z = beta by prefix sums of coordinates.
+// An element takes ceil(M / 128) SSE2 registers, where bit i is the coordinate of beta_i.
+template<size_t __M, size_t __Type>
+struct OnbFieldTraits {
+    static_assert(OnbMultiplicationTable<__M, __Type>::IsOptimalNormalBasis(), "GF(2^M) has no optimal normal basis of this type.");
+
+    static constexpr size_t WordCountValue = (__M + 127) / 128;
+
+    struct ElementType {
+        __m128i Words[WordCountValue];
+    };
+
+    using TraceType = size_t;
+
+    static constexpr size_t BinaryBitSizeValue = __M;
+    static constexpr size_t BinaryByteSizeValue = (BinaryBitSizeValue + 7) / 8;
+
+    static inline constexpr typename OnbMultiplicationTable<__M, __Type>::TableType MultiplicationTable =
+        OnbMultiplicationTable<__M, __Type>::Generate();
+
+    static inline constexpr const uint16_t (&T0)[__M] = MultiplicationTable.T0;
+    static inline constexpr const uint16_t (&T1)[__M] = MultiplicationTable.T1;
+
+    // Bits of the last word which are in use
+    static constexpr size_t TopBitCountValue = __M - 128 * (WordCountValue - 1);
+
+    static inline __m128i TopMask() noexcept {
+        constexpr uint64_t Low = TopBitCountValue >= 64 ? ~uint64_t{ 0 } : (uint64_t{ 1 } << TopBitCountValue) - 1;
+        constexpr uint64_t High = TopBitCountValue == 128 ? ~uint64_t{ 0 } : TopBitCountValue > 64 ? (uint64_t{ 1 } << (TopBitCountValue - 64)) - 1 : 0;
+        return _mm_set_epi64x(static_cast<long long>(High), static_cast<long long>(Low));
+    }
+
+    static void Verify(const ElementType& Element) {
+        __m128i Excess = _mm_andnot_si128(TopMask(), Element.Words[WordCountValue - 1]);
+
+        if (_mm_movemask_epi8(_mm_cmpeq_epi32(Excess, _mm_setzero_si128())) != 0xffff) {
+            throw std::invalid_argument("Element is not in GF(2 ^ M).");
+        }
+    }
+
+    [[nodiscard]]
+    static size_t Serialize(const ElementType& Element, void* lpBinary, size_t cbBinary) {
+        if (cbBinary < BinaryByteSizeValue) {
+            throw std::length_error("Insufficient buffer.");
+        } else {
+            memcpy(lpBinary, Element.Words, BinaryByteSizeValue);
+            return BinaryByteSizeValue;
+        }
+    }
+
+    [[nodiscard]]
+    static std::vector<uint8_t> Serialize(const ElementType& Element) noexcept {
+        return std::vector<uint8_t>(
+            reinterpret_cast<const uint8_t*>(Element.Words),
+            reinterpret_cast<const uint8_t*>(Element.Words) + BinaryByteSizeValue
+        );
+    }
+
+    static void Deserialize(ElementType& Element, const void* lpSerializedBytes, size_t cbSerializedBytes) {
+        if (cbSerializedBytes != BinaryByteSizeValue) {
+            throw std::length_error("The length of buffer is not correct.");
+        } else {
+            ElementType t;
+
+            SetZero(t);
+            memcpy(t.Words, lpSerializedBytes, BinaryByteSizeValue);
+            Verify(t);
+
+            Element = t;
+        }
+    }
+
+    static inline void SetZero(ElementType& Element) noexcept {
+        for (size_t w = 0; w < WordCountValue; ++w) {
+            Element.Words[w] = _mm_setzero_si128();
+        }
+    }
+
+    // 1 = sum(beta_i) for both types
+    static inline void SetOne(ElementType& Element) noexcept {
+        for (size_t w = 0; w + 1 < WordCountValue; ++w) {
+            Element.Words[w] = _mm_set1_epi32(-1);
+        }
+        Element.Words[WordCountValue - 1] = TopMask();
+    }
+
+    static inline bool IsEqual(const ElementType& A, const ElementType& B) noexcept {
+        __m128i Difference = _mm_setzero_si128();
+        for (size_t w = 0; w < WordCountValue; ++w) {
+            Difference = _mm_or_si128(Difference, _mm_xor_si128(A.Words[w], B.Words[w]));
+        }
+        return _mm_movemask_epi8(_mm_cmpeq_epi32(Difference, _mm_setzero_si128())) == 0xffff;
+    }
+
+    static inline bool IsZero(const ElementType& Element) noexcept {
+        __m128i Bits = _mm_setzero_si128();
+        for (size_t w = 0; w < WordCountValue; ++w) {
+            Bits = _mm_or_si128(Bits, Element.Words[w]);
+        }
+        return _mm_movemask_epi8(_mm_cmpeq_epi32(Bits, _mm_setzero_si128())) == 0xffff;
+    }
+
+    static inline bool IsOne(const ElementType& Element) noexcept {
+        ElementType One;
+        SetOne(One);
+        return IsEqual(Element, One);
+    }
+
+    // Result = -A
+    static inline void Negative(ElementType& Result, const ElementType& A) {
+        Result = A;
+    }
+
+    // Result = A + B
+    static inline void Add(ElementType& Result, const ElementType& A, const ElementType& B) noexcept {
+        for (size_t w = 0; w < WordCountValue; ++w) {
+            Result.Words[w] = _mm_xor_si128(A.Words[w], B.Words[w]);
+        }
+    }
+
+    // A += B
+    static inline void AddAssign(ElementType& A, const ElementType& B) noexcept {
+        Add(A, A, B);
+    }
+
+    // Result = A + 1
+    static inline void AddOne(ElementType& Result, const ElementType& A) noexcept {
+        ElementType One;
+        SetOne(One);
+        Add(Result, A, One);
+    }
+
+    // A += 1
+    static inline void AddOneAssign(ElementType& A) noexcept {
+        AddOne(A, A);
+    }
+
+    // Result = A - B
+    static inline void Substract(ElementType& Result, const ElementType& A, const ElementType& B) noexcept {
+        Add(Result, A, B);
+    }
+
+    // A -= B
+    static inline void SubstractAssign(ElementType& A, const ElementType& B) noexcept {
+        Add(A, A, B);
+    }
+
+    // Result = A - 1
+    static inline void SubstractOne(ElementType& Result, const ElementType& A) noexcept {
+        AddOne(Result, A);
+    }
+
+    // A -= 1
+    static inline void SubstractOneAssign(ElementType& A) noexcept {
+        AddOne(A, A);
+    }
+
+    // Result = A << k    where 0 <= k <= 128, see `VisualAssistFieldTraitsBase::ShiftLeft128`
+    static inline __m128i ShiftLeft128(const __m128i& A, size_t k) noexcept {
+        __m128i Low = _mm_slli_si128(A, 8);
+        return _mm_or_si128(
+            _mm_or_si128(
+                _mm_sll_epi64(A, _mm_cvtsi32_si128(static_cast<int>(k))),
+                _mm_srl_epi64(Low, _mm_cvtsi32_si128(static_cast<int>(64 - k)))
+            ),
+            _mm_sll_epi64(Low, _mm_cvtsi32_si128(static_cast<int>(k - 64)))
+        );
+    }
+
+    // Result = A >> k    where 0 <= k <= 128
+    static inline __m128i ShiftRight128(const __m128i& A, size_t k) noexcept {
+        __m128i High = _mm_srli_si128(A, 8);
+        return _mm_or_si128(
+            _mm_or_si128(
+                _mm_srl_epi64(A, _mm_cvtsi32_si128(static_cast<int>(k))),
+                _mm_sll_epi64(High, _mm_cvtsi32_si128(static_cast<int>(64 - k)))
+            ),
+            _mm_srl_epi64(High, _mm_cvtsi32_si128(static_cast<int>(k - 64)))
+        );
+    }
+
+    // Result = A << k    where 0 <= k <= M, bits above M are kept
+    static inline void ShiftLeft(ElementType& Result, const ElementType& A, size_t k) noexcept {
+        ElementType t;
+        size_t q = k / 128;
+        size_t r = k % 128;
+
+        for (size_t w = 0; w < WordCountValue; ++w) {
+            t.Words[w] = w >= q ? ShiftLeft128(A.Words[w - q], r) : _mm_setzero_si128();
+            if (w >= q + 1) {
+                t.Words[w] = _mm_or_si128(t.Words[w], ShiftRight128(A.Words[w - q - 1], 128 - r));
+            }
+        }
+
+        Result = t;
+    }
+
+    // Result = A >> k    where 0 <= k <= M
+    static inline void ShiftRight(ElementType& Result, const ElementType& A, size_t k) noexcept {
+        ElementType t;
+        size_t q = k / 128;
+        size_t r = k % 128;
+
+        for (size_t w = 0; w < WordCountValue; ++w) {
+            t.Words[w] = w + q < WordCountValue ? ShiftRight128(A.Words[w + q], r) : _mm_setzero_si128();
+            if (w + q + 1 < WordCountValue) {
+                t.Words[w] = _mm_or_si128(t.Words[w], ShiftLeft128(A.Words[w + q + 1], 128 - r));
+            }
+        }
+
+        Result = t;
+    }
+
+    static inline void RotateShiftLeftByOne(ElementType& Result, const ElementType& A) noexcept {
+        ElementType t;
+
+        for (size_t w = 0; w < WordCountValue; ++w) {
+            __m128i Low = _mm_slli_si128(A.Words[w], 8);
+            if (w > 0) {
+                Low = _mm_or_si128(Low, _mm_srli_si128(A.Words[w - 1], 8));
+            }
+            t.Words[w] = _mm_or_si128(_mm_slli_epi64(A.Words[w], 1), _mm_srli_epi64(Low, 63));
+        }
+
+        // bit M - 1 -> bit 0
+        t.Words[0] = _mm_or_si128(
+            t.Words[0],
+            _mm_and_si128(ShiftRight128(A.Words[WordCountValue - 1], TopBitCountValue - 1), _mm_cvtsi32_si128(1))
+        );
+        t.Words[WordCountValue - 1] = _mm_and_si128(t.Words[WordCountValue - 1], TopMask());
+
+        Result = t;
+    }
+
+    static inline void RotateShiftLeftByOneAssign(ElementType& A) noexcept {
+        RotateShiftLeftByOne(A, A);
+    }
+
+    static inline void RotateShiftRightByOne(ElementType& Result, const ElementType& A) noexcept {
+        ElementType t;
+
+        for (size_t w = 0; w < WordCountValue; ++w) {
+            __m128i High = _mm_srli_si128(A.Words[w], 8);
+            if (w + 1 < WordCountValue) {
+                High = _mm_or_si128(High, _mm_slli_si128(A.Words[w + 1], 8));
+            }
+            t.Words[w] = _mm_or_si128(_mm_srli_epi64(A.Words[w], 1), _mm_slli_epi64(High, 63));
+        }
+
+        // bit 0 -> bit M - 1
+        t.Words[WordCountValue - 1] = _mm_or_si128(
+            t.Words[WordCountValue - 1],
+            ShiftLeft128(_mm_and_si128(A.Words[0], _mm_cvtsi32_si128(1)), TopBitCountValue - 1)
+        );
+
+        Result = t;
+    }
+
+    static inline void RotateShiftRightByOneAssign(ElementType& A) noexcept {
+        RotateShiftRightByOne(A, A);
+    }
+
+    // Result = A ^ (2 ^ k)    where 0 <= k < M
+    static inline void RotateShiftLeft(ElementType& Result, const ElementType& A, size_t k) noexcept {
+        ElementType High, Low;
+        ShiftLeft(High, A, k);
+        ShiftRight(Low, A, BinaryBitSizeValue - k);
+        Add(Result, High, Low);
+        Result.Words[WordCountValue - 1] = _mm_and_si128(Result.Words[WordCountValue - 1], TopMask());
+    }
+
+    static inline void RotateShiftLeftAssign(ElementType& A, size_t k) noexcept {
+        RotateShiftLeft(A, A, k);
+    }
+
+    // Result = A ^ (2 ^ -k)    where 0 <= k < M
+    static inline void RotateShiftRight(ElementType& Result, const ElementType& A, size_t k) noexcept {
+        RotateShiftLeft(Result, A, k == 0 ? 0 : BinaryBitSizeValue - k);
+    }
+
+    static inline void RotateShiftRightAssign(ElementType& A, size_t k) noexcept {
+        RotateShiftRight(A, A, k);
+    }
+
+    // Rotated copies of the multiplier, already combined by `T0` and `T1`.
+    struct PreparedType {
+        ElementType MatrixB[__M];
+    };
+
+    static inline void Prepare(PreparedType& Prepared, const ElementType& B) noexcept {
+        ElementType MatrixB[__M];
+
+        MatrixB[0] = B;
+        for (size_t i = 1; i < __M; ++i) {
+            RotateShiftRightByOne(MatrixB[i], MatrixB[i - 1]);
+        }
+
+        Prepared.MatrixB[0] = MatrixB[T0[0]];
+        for (size_t i = 1; i < __M; ++i) {
+            Add(Prepared.MatrixB[i], MatrixB[T0[i]], MatrixB[T1[i]]);
+        }
+    }
+
+    // Result = A * B
+    static inline void MultiplyPrepared(ElementType& Result, const ElementType& A, const PreparedType& B) noexcept {
+        ElementType Ak = A;
+        ElementType c;
+
+        for (size_t w = 0; w < WordCountValue; ++w) {
+            c.Words[w] = _mm_and_si128(Ak.Words[w], B.MatrixB[0].Words[w]);
+        }
+
+        for (size_t i = 1; i < __M; ++i) {
+            RotateShiftRightByOneAssign(Ak);
+            for (size_t w = 0; w < WordCountValue; ++w) {
+                c.Words[w] = _mm_xor_si128(c.Words[w], _mm_and_si128(Ak.Words[w], B.MatrixB[i].Words[w]));
+            }
+        }
+
+        Result = c;
+    }
+
+    // A *= B
+    static inline void MultiplyPreparedAssign(ElementType& A, const PreparedType& B) noexcept {
+        MultiplyPrepared(A, A, B);
+    }
+
+    // Result = A * B
+    // https://www.princeton.edu/~rblee/ELE572Papers/Fall04Readings/NingYin-FiniteFieldMul.pdf
+    static inline void Multiply(ElementType& Result, const ElementType& A, const ElementType& B) noexcept {
+        ElementType MatrixB[__M];
+
+        MatrixB[0] = B;
+        for (size_t i = 1; i < __M; ++i) {
+            RotateShiftRightByOne(MatrixB[i], MatrixB[i - 1]);
+        }
+
+        ElementType Ak = A;
+        ElementType c;
+
+        for (size_t w = 0; w < WordCountValue; ++w) {
+            c.Words[w] = _mm_and_si128(Ak.Words[w], MatrixB[T0[0]].Words[w]);
+        }
+
+        for (size_t i = 1; i < __M; ++i) {
+            RotateShiftRightByOneAssign(Ak);
+            for (size_t w = 0; w < WordCountValue; ++w) {
+                c.Words[w] = _mm_xor_si128(
+                    c.Words[w],
+                    _mm_and_si128(Ak.Words[w], _mm_xor_si128(MatrixB[T0[i]].Words[w], MatrixB[T1[i]].Words[w]))
+                );
+            }
+        }
+
+        Result = c;
+    }
+
+    // A *= B
+    static inline void MultiplyAssign(ElementType& A, const ElementType& B) noexcept {
+        Multiply(A, A, B);
+    }
+
+    static inline void Divide(ElementType& Result, const ElementType& A, const ElementType& B) {
+        ElementType InverseOfB;
+        Inverse(InverseOfB, B);
+        Multiply(Result, A, InverseOfB);
+    }
+
+    static inline void DivideAssign(ElementType& A, const ElementType& B) {
+        ElementType InverseOfB;
+        Inverse(InverseOfB, B);
+        MultiplyAssign(A, InverseOfB);
+    }
+
+    // Result = A ^ -1
+    // Itoh-Tsujii as in `VisualAssistFieldTraitsBase::Inverse`, the addition chain of M - 1 is read from its bits:
+    // every bit doubles k, and a set bit adds 1 to it.
+    static inline void Inverse(ElementType& Result, const ElementType& A) {
+        constexpr size_t Exponent = __M - 1;
+
+        size_t BitCount = 0;
+        while ((Exponent >> BitCount) > 1) {
+            ++BitCount;
+        }
+
+        ElementType eta = A;    // beta_k
+        size_t k = 1;
+
+        for (size_t i = BitCount; i-- > 0;) {
+            ElementType mu;
+            RotateShiftLeft(mu, eta, k);
+            MultiplyAssign(eta, mu);            // beta_2k = beta_k ^ (2 ^ k) * beta_k
+            k *= 2;
+
+            if (Exponent >> i & 1) {
+                SquareAssign(eta);
+                MultiplyAssign(eta, A);         // beta_(k + 1) = beta_k ^ 2 * beta_1
+                k += 1;
+            }
+        }
+
+        Square(Result, eta);
+    }
+
+    // A = A ^ -1
+    static inline void InverseAssign(ElementType& A) {
+        Inverse(A, A);
+    }
+
+    // Result = A ^ 2
+    static inline void Square(ElementType& Result, const ElementType& A) noexcept {
+        RotateShiftLeftByOne(Result, A);
+    }
+
+    // A = A ^ 2
+    static inline void SquareAssign(ElementType& A) noexcept {
+        RotateShiftLeftByOneAssign(A);
+    }
+
+    // Result = sqrt(A)
+    static inline void SquareRoot(ElementType& Result, const ElementType& A) noexcept {
+        RotateShiftRightByOne(Result, A);
+    }
+
+    // A = sqrt(A)
+    static inline void SquareRootAssign(ElementType& A) noexcept {
+        RotateShiftRightByOneAssign(A);
+    }
+
+    // Results[i] = As[i] * Bs[i]    where 0 <= i < Count
+    static void MultiplyN(ElementType Results[], const ElementType As[], const ElementType Bs[], size_t Count) noexcept {
+        for (size_t i = 0; i < Count; ++i) {
+            Multiply(Results[i], As[i], Bs[i]);
+        }
+    }
+
+    // Results[i] = As[i] ^ 2    where 0 <= i < Count
+    static void SquareN(ElementType Results[], const ElementType As[], size_t Count) noexcept {
+        for (size_t i = 0; i < Count; ++i) {
+            Square(Results[i], As[i]);
+        }
+    }
+
+    // Results[i] = As[i] ^ -1    where 0 <= i < Count
+    static void InverseN(ElementType Results[], const ElementType As[], size_t Count) {
+        for (size_t i = 0; i < Count; ++i) {
+            Inverse(Results[i], As[i]);
+        }
+    }
+
+    // Batches up to this size take no heap allocation in `BatchInverse`.
+    static constexpr size_t BatchInverseStackCount = 64;
+
+    // Results[i] = As[i] ^ -1    where 0 <= i < Count, `Results` may be the same array as `As`
+    // See `VisualAssistFieldTraitsBase::BatchInverse`.
+    static void BatchInverse(ElementType Results[], const ElementType As[], size_t Count) {
+        if (Count == 0) {
+            return;
+        }
+
+        ElementType StackPrefixes[BatchInverseStackCount];
+        std::unique_ptr<ElementType[]> HeapPrefixes(Count > BatchInverseStackCount ? new ElementType[Count] : nullptr);
+        ElementType* Prefixes = HeapPrefixes ? HeapPrefixes.get() : StackPrefixes;
+
+        Prefixes[0] = As[0];
+        if (IsZero(Prefixes[0])) {
+            SetOne(Prefixes[0]);
+        }
+
+        for (size_t i = 1; i < Count; ++i) {
+            if (IsZero(As[i])) {
+                Prefixes[i] = Prefixes[i - 1];
+            } else {
+                Multiply(Prefixes[i], Prefixes[i - 1], As[i]);
+            }
+        }
+
+        ElementType InversePrefix;
+        Inverse(InversePrefix, Prefixes[Count - 1]);
+
+        for (size_t i = Count - 1; i > 0; --i) {
+            if (IsZero(As[i])) {
+                SetZero(Results[i]);
+            } else {
+                ElementType a = As[i];
+                Multiply(Results[i], Prefixes[i - 1], InversePrefix);
+                MultiplyAssign(InversePrefix, a);
+            }
+        }
+
+        if (IsZero(As[0])) {
+            SetZero(Results[0]);
+        } else {
+            Results[0] = InversePrefix;
+        }
+    }
+
+    // Result = tr(A)
+    // tr(beta_i) = 1 for every i, so tr(A) is the parity of A's bits.
+    static inline void Trace(TraceType& Result, const ElementType& A) {
+        __m128i v = A.Words[0];
+        for (size_t w = 1; w < WordCountValue; ++w) {
+            v = _mm_xor_si128(v, A.Words[w]);
+        }
+
+        alignas(16) uint64_t Halves[2];
+        _mm_store_si128(reinterpret_cast<__m128i*>(Halves), v);
+
+        uint64_t x = Halves[0] ^ Halves[1];
+        x ^= x >> 32;
+        x ^= x >> 16;
+        x ^= x >> 8;
+        x ^= x >> 4;
+        x ^= x >> 2;
+        x ^= x >> 1;
+
+        Result = static_cast<TraceType>(x & 1);
+    }
+
+    // Find a `z` which satisfies `z^2 + z = Beta`, the other one is `z + 1`
+    // z_i - z_(i - 1) = beta_i, so with z_0 = 0, z_i is the sum of beta_1, ..., beta_i.
+    [[nodiscard]]
+    static inline bool SolveQuadratic(ElementType& Element, const ElementType& Beta) {
+        TraceType tr;
+        Trace(tr, Beta);
+
+        if (tr == 1) {
+            return false;
+        } else {
+            ElementType z = Beta;
+            z.Words[0] = _mm_andnot_si128(_mm_cvtsi32_si128(1), z.Words[0]);
+
+            for (size_t s = 1; s < BinaryBitSizeValue; s *= 2) {
+                ElementType t;
+                ShiftLeft(t, z, s);
+                AddAssign(z, t);
+            }
+
+            z.Words[WordCountValue - 1] = _mm_and_si128(z.Words[WordCountValue - 1], TopMask());
+            Element = z;
+            return true;
+        }
+    }
+
+    // Find root `x`s which satisfies `A * x ^ 2 + B * x + C = 0`
+    // Roots are written to `Roots`, and the number of roots, 0, 1 or 2, is returned.
+    [[nodiscard]]
+    static inline size_t SolveQuadratic(ElementType (&Roots)[2], const ElementType& A, const ElementType& B, const ElementType& C) {
+        if (IsZero(A)) {
+            throw std::invalid_argument("A cannot be zero.");
+        }
+
+        if (IsZero(B)) {
+            // A * x ^ 2 + C = 0
+            //  x = sqrt(C / A)
+            Divide(Roots[0], C, A);
+            SquareRootAssign(Roots[0]);
+
+            return 1;
+        } else {
+            // See `VisualAssistFieldTraitsBase::SolveQuadratic`
+            ElementType BB;
+            ElementType InverseOfABB;
+            ElementType beta;
+            ElementType BOverA;
+
+            Square(BB, B);
+            Multiply(InverseOfABB, A, BB);
+            InverseAssign(InverseOfABB);
+
+            Multiply(beta, A, C);
+            MultiplyAssign(beta, A);
+            MultiplyAssign(beta, InverseOfABB);     // beta = A ^ 2 * C / (A * B ^ 2)
+
+            Multiply(BOverA, BB, B);
+            MultiplyAssign(BOverA, InverseOfABB);   // B / A = B ^ 3 / (A * B ^ 2)
+
+            if (SolveQuadratic(Roots[0], beta)) {
+                MultiplyAssign(Roots[0], BOverA);
+                Add(Roots[1], Roots[0], BOverA);
+
+                return 2;
+            } else {
+                return 0;
+            }
+        }
+    }
+};
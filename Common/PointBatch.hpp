@@ -0,0 +1,243 @@
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+#include <stdexcept>
+#include <vector>
+
+// Affine points of one curve, with x and y in separate arrays so that the field's N-way kernels run over them.
+// Every group operation is done on the whole batch with one inversion shared by Montgomery's trick, where
+// an affine addition takes 1I + 2M + 1S, i.e. 5M + 1S a point once the inversion is spread over the batch,
+// against the 8M + 5S of a mixed addition plus the normalization of its result. A doubling takes one more S.
+// The infinity point is (0, 0), which is never on the curve as B != 0.
+template<typename __CurveType>
+class PointBatch {
+public:
+
+    using PointType = typename __CurveType::Point;
+    using FieldType = typename __CurveType::FieldType;
+
+private:
+
+    const __CurveType& m_Curve;
+    std::vector<FieldType> m_X;
+    std::vector<FieldType> m_Y;
+
+    [[nodiscard]]
+    bool IsAtInfinity(size_t i) const noexcept {
+        return m_X[i].IsZero() && m_Y[i].IsZero();
+    }
+
+    // *this[i] += (X2[i * Stride], Y2[i * Stride]), where Stride = 0 adds one point to all of them.
+    //     P1 + P2:  lambda = (y1 + y2) / (x1 + x2),  x3 = lambda^2 + lambda + x1 + x2 + a,  y3 = lambda * (x1 + x3) + x3 + y1
+    //     2 * P1:   lambda = x1 + y1 / x1,           x3 = lambda^2 + lambda + a,            y3 = lambda * x3 + x3 + x1^2
+    // Hankerson, Menezes, Vanstone. Guide to Elliptic Curve Cryptography. Section 3.1.2
+    void AddAffine(const FieldType X2[], const FieldType Y2[], size_t Stride) {
+        enum : uint8_t { Generic, Doubling, Infinity, Other, Unchanged };
+
+        size_t Count = m_X.size();
+        const auto& A = m_Curve.GetParameterA();
+
+        std::vector<uint8_t> Kinds(Count);
+        std::vector<FieldType> Lambda(Count);       // the numerators, then lambda
+        std::vector<FieldType> Denominators(Count);
+
+        for (size_t i = 0; i < Count; ++i) {
+            const auto& x2 = X2[i * Stride];
+            const auto& y2 = Y2[i * Stride];
+
+            if (x2.IsZero() && y2.IsZero()) {
+                Kinds[i] = Unchanged;
+            } else if (IsAtInfinity(i)) {
+                Kinds[i] = Other;
+            } else if (m_X[i] != x2) {
+                Kinds[i] = Generic;
+                Denominators[i] = m_X[i] + x2;
+                Lambda[i] = m_Y[i] + y2;
+            } else if (m_Y[i] == y2 && m_X[i].IsZero() == false) {
+                Kinds[i] = Doubling;
+                Denominators[i] = m_X[i];
+                Lambda[i] = m_Y[i];
+            } else {
+                Kinds[i] = Infinity;                // P1 = -P2, or P1 = P2 of order 2
+            }
+        }
+
+        FieldType::BatchInverse(Denominators.data(), Count);
+        FieldType::MultiplyN(Lambda.data(), Lambda.data(), Denominators.data(), Count);
+
+        for (size_t i = 0; i < Count; ++i) {
+            if (Kinds[i] == Doubling) {
+                Lambda[i] += m_X[i];
+            }
+        }
+
+        // lambda^2, then lambda * (x1 + x3) or lambda * x3
+        std::vector<FieldType> Products(Count);
+        FieldType::SquareN(Products.data(), Lambda.data(), Count);
+
+        std::vector<FieldType> Factors(Count);
+
+        for (size_t i = 0; i < Count; ++i) {
+            if (Kinds[i] == Generic) {
+                auto X3 = Products[i] + Lambda[i] + m_X[i] + X2[i * Stride] + A;
+                Factors[i] = m_X[i] + X3;
+                m_X[i] = X3;
+            } else if (Kinds[i] == Doubling) {
+                auto X3 = Products[i] + Lambda[i] + A;
+                Factors[i] = X3;
+                m_Y[i] = m_X[i].SquareValue();      // x1^2 takes the place of y1
+                m_X[i] = X3;
+            }
+        }
+
+        FieldType::MultiplyN(Products.data(), Lambda.data(), Factors.data(), Count);
+
+        for (size_t i = 0; i < Count; ++i) {
+            switch (Kinds[i]) {
+                case Generic:
+                case Doubling:
+                    m_Y[i] += Products[i];
+                    m_Y[i] += m_X[i];
+                    break;
+                case Infinity:
+                    m_X[i].SetZero();
+                    m_Y[i].SetZero();
+                    break;
+                case Other:
+                    m_X[i] = X2[i * Stride];
+                    m_Y[i] = Y2[i * Stride];
+                    break;
+                default:
+                    break;
+            }
+        }
+    }
+
+public:
+
+    explicit PointBatch(const __CurveType& Curve) noexcept :
+        m_Curve(Curve) {}
+
+    PointBatch(const __CurveType& Curve, const PointType Points[], size_t Count) :
+        m_Curve(Curve)
+    {
+        Normalize(Points, Count);
+    }
+
+    [[nodiscard]]
+    size_t GetCount() const noexcept {
+        return m_X.size();
+    }
+
+    [[nodiscard]]
+    const FieldType* GetX() const noexcept {
+        return m_X.data();
+    }
+
+    [[nodiscard]]
+    const FieldType* GetY() const noexcept {
+        return m_Y.data();
+    }
+
+    void Reserve(size_t Count) {
+        m_X.reserve(Count);
+        m_Y.reserve(Count);
+    }
+
+    void Clear() noexcept {
+        m_X.clear();
+        m_Y.clear();
+    }
+
+    // The i-th point, affine
+    [[nodiscard]]
+    PointType operator[](size_t i) const noexcept {
+        PointType P(m_Curve);
+
+        if (IsAtInfinity(i) == false) {
+            P.m_X = m_X[i];
+            P.m_Y = m_Y[i];
+            P.m_Z.SetOne();
+        }
+
+        return P;
+    }
+
+    // Takes an inversion unless P is affine.
+    void Append(const PointType& P) {
+        if (P.m_Curve != m_Curve) {
+            throw std::invalid_argument("Not on the same curve.");
+        }
+
+        m_X.emplace_back();
+        m_Y.emplace_back();
+        P.GetAffine(m_X.back(), m_Y.back());
+    }
+
+    void Append(const PointBatch& Other) {
+        if (Other.m_Curve != m_Curve) {
+            throw std::invalid_argument("Not on the same curve.");
+        }
+
+        m_X.insert(m_X.end(), Other.m_X.begin(), Other.m_X.end());
+        m_Y.insert(m_Y.end(), Other.m_Y.begin(), Other.m_Y.end());
+    }
+
+    // *this = Points[0 .. Count - 1], which are normalized by one inversion for all of them.
+    void Normalize(const PointType Points[], size_t Count) {
+        m_X.resize(Count);
+        m_Y.resize(Count);
+
+        for (size_t i = 0; i < Count; ++i) {
+            if (Points[i].m_Curve != m_Curve) {
+                throw std::invalid_argument("Not on the same curve.");
+            }
+            m_Y[i] = Points[i].m_Z;
+        }
+
+        FieldType::BatchInverse(m_Y.data(), Count);
+
+        for (size_t i = 0; i < Count; ++i) {
+            if (Points[i].IsAtInfinity()) {
+                m_X[i].SetZero();
+            } else {
+                m_X[i] = Points[i].m_X * m_Y[i];
+                m_Y[i].Square();
+                m_Y[i] *= Points[i].m_Y;
+            }
+        }
+    }
+
+    // *this[i] += Other[i]
+    void Add(const PointBatch& Other) {
+        if (Other.m_Curve != m_Curve || Other.GetCount() != GetCount()) {
+            throw std::invalid_argument("Batches don't match.");
+        }
+
+        AddAffine(Other.m_X.data(), Other.m_Y.data(), 1);
+    }
+
+    // *this[i] += Q
+    void Add(const PointType& Q) {
+        if (Q.m_Curve != m_Curve) {
+            throw std::invalid_argument("Not on the same curve.");
+        }
+
+        FieldType X, Y;
+        Q.GetAffine(X, Y);
+
+        AddAffine(&X, &Y, 0);
+    }
+
+    // *this[i] *= 2
+    void Double() {
+        AddAffine(m_X.data(), m_Y.data(), 1);
+    }
+
+    // *this[i] = -*this[i], i.e. (x, x + y), while (0, 0) stays.
+    void Negate() noexcept {
+        for (size_t i = 0; i < m_X.size(); ++i) {
+            m_Y[i] += m_X[i];
+        }
+    }
+};
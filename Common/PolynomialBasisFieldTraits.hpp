@@ -0,0 +1,616 @@
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+#include <memory.h>
+#include <memory>
+#include <vector>
+#include <stdexcept>
+#include "VisualAssistDispatch.hpp"
+
+// Lower terms of a reduction polynomial f(x) = x^M + x^K1 + ... + x^Kn + 1, in descending order, e.g.
+//     ReductionPolynomial<74>           for the trinomial   x^233 + x^74 + 1
+//     ReductionPolynomial<7, 6, 3>      for the pentanomial x^163 + x^7 + x^6 + x^3 + 1
+template<size_t... __Exponents>
+struct ReductionPolynomial {
+    static_assert(sizeof...(__Exponents) == 1 || sizeof...(__Exponents) == 3, "Only trinomials and pentanomials are supported.");
+};
+
+// Byte-wise tables for squares and square roots in polynomial basis.
+struct PolynomialBasisTables {
+    // Spread[b]: bit i of b moved to bit 2 * i, i.e. b(x) ^ 2 before reduction
+    uint16_t Spread[256];
+
+    // Compress[b]: even bits of b in the low nibble, odd bits in the high nibble
+    uint8_t Compress[256];
+
+    static constexpr PolynomialBasisTables Generate() noexcept {
+        PolynomialBasisTables Tables = {};
+
+        for (unsigned b = 0; b < 256; ++b) {
+            for (unsigned i = 0; i < 8; ++i) {
+                if (b >> i & 1) {
+                    Tables.Spread[b] |= static_cast<uint16_t>(1u << 2 * i);
+                    Tables.Compress[b] |= static_cast<uint8_t>(1u << (i % 2 * 4 + i / 2));
+                }
+            }
+        }
+
+        return Tables;
+    }
+};
+
+// Reduction modulo f(x) and the constants which depend on f(x) only.
+// These are generated at compile time, so they can't live in `PolynomialBasisFieldTraits` itself.
+template<size_t __M, typename __ReductionPolynomial>
+struct PolynomialBasisReduction;
+
+template<size_t __M, size_t... __Exponents>
+struct PolynomialBasisReduction<__M, ReductionPolynomial<__Exponents...>> {
+
+    static constexpr size_t WordCountValue = (__M + 63) / 64;
+
+    // f(x) - x^M
+    static constexpr size_t Exponents[] = { __Exponents..., 0 };
+
+    // A 64-bit word folded at x^K stays below the word it came from if M - K >= 64.
+    static constexpr bool IsFastReducible() noexcept {
+        for (size_t k : Exponents) {
+            if (k + 64 > __M) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    static_assert(IsFastReducible(), "Middle terms of the reduction polynomial must be at least 64 lower than x^M.");
+
+    static constexpr PolynomialBasisTables Tables = PolynomialBasisTables::Generate();
+
+    struct ElementType {
+        uint64_t Words[WordCountValue];
+    };
+
+    struct ProductType {
+        uint64_t Words[2 * WordCountValue];
+    };
+
+    // c += t * x^(64 * i - M + K)
+    // Shifts depend on K and M only, so they are constants.
+    template<size_t __K>
+    static constexpr void Fold(ProductType& c, size_t i, uint64_t t) noexcept {
+        constexpr size_t d = 64 * WordCountValue - __M + __K;     // 64 * i - M + K = 64 * (i - W) + d
+
+        c.Words[i - WordCountValue + d / 64] ^= t << d % 64;
+        if constexpr (d % 64 != 0) {
+            c.Words[i - WordCountValue + d / 64 + 1] ^= t >> (64 - d % 64);
+        }
+    }
+
+    // c += t * x^K
+    template<size_t __K>
+    static constexpr void FoldTop(ProductType& c, uint64_t t) noexcept {
+        c.Words[__K / 64] ^= t << __K % 64;
+        if constexpr (__K % 64 != 0) {
+            c.Words[__K / 64 + 1] ^= t >> (64 - __K % 64);
+        }
+    }
+
+    // Result = c mod f(x)    where deg(c) < 2 * M - 1, `c` is clobbered
+    // Words above M are folded one word at a time by x^M = f(x) - x^M, from the top down.
+    static constexpr void Reduce(ElementType& Result, ProductType& c) noexcept {
+        for (size_t i = 2 * WordCountValue - 1; i >= WordCountValue; --i) {
+            uint64_t t = c.Words[i];
+            (Fold<__Exponents>(c, i, t), ...);
+            Fold<0>(c, i, t);
+        }
+
+        if constexpr (__M % 64 != 0) {
+            uint64_t t = c.Words[WordCountValue - 1] >> __M % 64;
+            c.Words[WordCountValue - 1] &= (uint64_t{ 1 } << __M % 64) - 1;
+            (FoldTop<__Exponents>(c, t), ...);
+            FoldTop<0>(c, t);
+        }
+
+        for (size_t w = 0; w < WordCountValue; ++w) {
+            Result.Words[w] = c.Words[w];
+        }
+    }
+
+    // Result = A ^ 2
+    static constexpr void Square(ElementType& Result, const ElementType& A) noexcept {
+        ProductType c = {};
+
+        for (size_t w = 0; w < WordCountValue; ++w) {
+            uint64_t a = A.Words[w];
+            c.Words[2 * w] =
+                uint64_t{ Tables.Spread[a & 0xff] } | uint64_t{ Tables.Spread[a >> 8 & 0xff] } << 16 |
+                uint64_t{ Tables.Spread[a >> 16 & 0xff] } << 32 | uint64_t{ Tables.Spread[a >> 24 & 0xff] } << 48;
+            c.Words[2 * w + 1] =
+                uint64_t{ Tables.Spread[a >> 32 & 0xff] } | uint64_t{ Tables.Spread[a >> 40 & 0xff] } << 16 |
+                uint64_t{ Tables.Spread[a >> 48 & 0xff] } << 32 | uint64_t{ Tables.Spread[a >> 56] } << 48;
+        }
+
+        Reduce(Result, c);
+    }
+
+    // sqrt(x) = x ^ (2 ^ (M - 1))
+    static constexpr ElementType GenerateSquareRootOfX() noexcept {
+        ElementType Result = {};
+
+        Result.Words[0] = 2;
+        for (size_t i = 1; i < __M; ++i) {
+            Square(Result, Result);
+        }
+
+        return Result;
+    }
+
+    // Bit i is tr(x ^ i), by Newton's identities on the roots of f(x):
+    //     tr(x ^ i) = sum(f_(M - j) * tr(x ^ (i - j)))    where 0 < j < i, plus i * f_(M - i)
+    static constexpr ElementType GenerateTraceMask() noexcept {
+        ElementType Result = {};
+        bool Traces[__M] = {};
+
+        Traces[0] = __M % 2 == 1;
+        for (size_t i = 1; i < __M; ++i) {
+            bool t = false;
+
+            for (size_t k : Exponents) {
+                size_t j = __M - k;         // f_(M - j) = 1
+                if (j < i) {
+                    t ^= Traces[i - j];
+                } else if (j == i && i % 2 == 1) {
+                    t ^= true;
+                }
+            }
+
+            Traces[i] = t;
+        }
+
+        for (size_t i = 0; i < __M; ++i) {
+            if (Traces[i]) {
+                Result.Words[i / 64] |= uint64_t{ 1 } << i % 64;
+            }
+        }
+
+        return Result;
+    }
+};
+
+// GF(2^M) = GF(2)[x] / f(x) with f(x) = x^M + `__ReductionPolynomial`, for NIST and SEC binary curves:
+//     1. multiplication by carry-less multiplication, PCLMULQDQ when available, see `VisualAssistDispatch::PolynomialKernel`,
+//        then reduction a word at a time, unrolled for f(x) at compile time,
+//     2. squares by a spread table, square roots by sqrt(A) = A_even(x) + sqrt(x) * A_odd(x),
+//     3. inversion by Itoh-Tsujii,
+//     4. z ^ 2 + z = beta by the half trace, which needs an odd M.
+// An element takes ceil(M / 64) 64-bit words, where bit i is the coefficient of x ^ i.
+template<size_t __M, typename __ReductionPolynomial>
+struct PolynomialBasisFieldTraits {
+
+    using Reduction = PolynomialBasisReduction<__M, __ReductionPolynomial>;
+
+    static constexpr size_t WordCountValue = Reduction::WordCountValue;
+
+    using ElementType = typename Reduction::ElementType;
+    using ProductType = typename Reduction::ProductType;
+
+    using TraceType = size_t;
+
+    static constexpr size_t BinaryBitSizeValue = __M;
+    static constexpr size_t BinaryByteSizeValue = (BinaryBitSizeValue + 7) / 8;
+
+    static inline constexpr ElementType SquareRootOfX = Reduction::GenerateSquareRootOfX();
+    static inline constexpr ElementType TraceMask = Reduction::GenerateTraceMask();
+
+    // Bits of the last word which are in use
+    static constexpr size_t TopBitCountValue = __M - 64 * (WordCountValue - 1);
+    static constexpr uint64_t TopMaskValue = TopBitCountValue == 64 ? ~uint64_t{ 0 } : (uint64_t{ 1 } << TopBitCountValue) - 1;
+
+    // Name of the carry-less multiplier in use, e.g. "PCLMULQDQ"
+    [[nodiscard]]
+    static const char* GetKernelName() noexcept {
+        return VisualAssistDispatch::Get().Polynomial.Name;
+    }
+
+    static void Verify(const ElementType& Element) {
+        if ((Element.Words[WordCountValue - 1] & ~TopMaskValue) != 0) {
+            throw std::invalid_argument("Element is not in GF(2 ^ M).");
+        }
+    }
+
+    [[nodiscard]]
+    static size_t Serialize(const ElementType& Element, void* lpBinary, size_t cbBinary) {
+        if (cbBinary < BinaryByteSizeValue) {
+            throw std::length_error("Insufficient buffer.");
+        } else {
+            memcpy(lpBinary, Element.Words, BinaryByteSizeValue);
+            return BinaryByteSizeValue;
+        }
+    }
+
+    [[nodiscard]]
+    static std::vector<uint8_t> Serialize(const ElementType& Element) noexcept {
+        return std::vector<uint8_t>(
+            reinterpret_cast<const uint8_t*>(Element.Words),
+            reinterpret_cast<const uint8_t*>(Element.Words) + BinaryByteSizeValue
+        );
+    }
+
+    static void Deserialize(ElementType& Element, const void* lpSerializedBytes, size_t cbSerializedBytes) {
+        if (cbSerializedBytes != BinaryByteSizeValue) {
+            throw std::length_error("The length of buffer is not correct.");
+        } else {
+            ElementType t;
+
+            SetZero(t);
+            memcpy(t.Words, lpSerializedBytes, BinaryByteSizeValue);
+            Verify(t);
+
+            Element = t;
+        }
+    }
+
+    static inline void SetZero(ElementType& Element) noexcept {
+        for (size_t w = 0; w < WordCountValue; ++w) {
+            Element.Words[w] = 0;
+        }
+    }
+
+    static inline void SetOne(ElementType& Element) noexcept {
+        SetZero(Element);
+        Element.Words[0] = 1;
+    }
+
+    static inline bool IsEqual(const ElementType& A, const ElementType& B) noexcept {
+        uint64_t Difference = 0;
+        for (size_t w = 0; w < WordCountValue; ++w) {
+            Difference |= A.Words[w] ^ B.Words[w];
+        }
+        return Difference == 0;
+    }
+
+    static inline bool IsZero(const ElementType& Element) noexcept {
+        uint64_t Bits = 0;
+        for (size_t w = 0; w < WordCountValue; ++w) {
+            Bits |= Element.Words[w];
+        }
+        return Bits == 0;
+    }
+
+    static inline bool IsOne(const ElementType& Element) noexcept {
+        ElementType One;
+        SetOne(One);
+        return IsEqual(Element, One);
+    }
+
+    // Result = -A
+    static inline void Negative(ElementType& Result, const ElementType& A) {
+        Result = A;
+    }
+
+    // Result = A + B
+    static inline void Add(ElementType& Result, const ElementType& A, const ElementType& B) noexcept {
+        for (size_t w = 0; w < WordCountValue; ++w) {
+            Result.Words[w] = A.Words[w] ^ B.Words[w];
+        }
+    }
+
+    // A += B
+    static inline void AddAssign(ElementType& A, const ElementType& B) noexcept {
+        Add(A, A, B);
+    }
+
+    // Result = A + 1
+    static inline void AddOne(ElementType& Result, const ElementType& A) noexcept {
+        Result = A;
+        Result.Words[0] ^= 1;
+    }
+
+    // A += 1
+    static inline void AddOneAssign(ElementType& A) noexcept {
+        AddOne(A, A);
+    }
+
+    // Result = A - B
+    static inline void Substract(ElementType& Result, const ElementType& A, const ElementType& B) noexcept {
+        Add(Result, A, B);
+    }
+
+    // A -= B
+    static inline void SubstractAssign(ElementType& A, const ElementType& B) noexcept {
+        Add(A, A, B);
+    }
+
+    // Result = A - 1
+    static inline void SubstractOne(ElementType& Result, const ElementType& A) noexcept {
+        AddOne(Result, A);
+    }
+
+    // A -= 1
+    static inline void SubstractOneAssign(ElementType& A) noexcept {
+        AddOne(A, A);
+    }
+
+    // Carry-less products don't benefit from preparation.
+    struct PreparedType {
+        ElementType Multiplier;
+    };
+
+    static inline void Prepare(PreparedType& Prepared, const ElementType& B) noexcept {
+        Prepared.Multiplier = B;
+    }
+
+    // Result = A * B
+    static inline void MultiplyPrepared(ElementType& Result, const ElementType& A, const PreparedType& B) noexcept {
+        Multiply(Result, A, B.Multiplier);
+    }
+
+    // A *= B
+    static inline void MultiplyPreparedAssign(ElementType& A, const PreparedType& B) noexcept {
+        Multiply(A, A, B.Multiplier);
+    }
+
+    // Result = A * B
+    static inline void Multiply(ElementType& Result, const ElementType& A, const ElementType& B) noexcept {
+        ProductType c;
+        VisualAssistDispatch::Get().Polynomial.Multiply(c.Words, A.Words, B.Words, WordCountValue);
+        Reduction::Reduce(Result, c);
+    }
+
+    // A *= B
+    static inline void MultiplyAssign(ElementType& A, const ElementType& B) noexcept {
+        Multiply(A, A, B);
+    }
+
+    static inline void Divide(ElementType& Result, const ElementType& A, const ElementType& B) {
+        ElementType InverseOfB;
+        Inverse(InverseOfB, B);
+        Multiply(Result, A, InverseOfB);
+    }
+
+    static inline void DivideAssign(ElementType& A, const ElementType& B) {
+        ElementType InverseOfB;
+        Inverse(InverseOfB, B);
+        MultiplyAssign(A, InverseOfB);
+    }
+
+    // Result = A ^ (2 ^ k)
+    static inline void RepeatedSquare(ElementType& Result, const ElementType& A, size_t k) noexcept {
+        Result = A;
+        for (size_t i = 0; i < k; ++i) {
+            Reduction::Square(Result, Result);
+        }
+    }
+
+    // Result = A ^ -1
+    // Itoh-Tsujii as in `OnbFieldTraits::Inverse`, with k squarings in place of a rotation by k.
+    static inline void Inverse(ElementType& Result, const ElementType& A) {
+        constexpr size_t Exponent = __M - 1;
+
+        size_t BitCount = 0;
+        while ((Exponent >> BitCount) > 1) {
+            ++BitCount;
+        }
+
+        ElementType eta = A;    // beta_k
+        size_t k = 1;
+
+        for (size_t i = BitCount; i-- > 0;) {
+            ElementType mu;
+            RepeatedSquare(mu, eta, k);
+            MultiplyAssign(eta, mu);            // beta_2k = beta_k ^ (2 ^ k) * beta_k
+            k *= 2;
+
+            if (Exponent >> i & 1) {
+                SquareAssign(eta);
+                MultiplyAssign(eta, A);         // beta_(k + 1) = beta_k ^ 2 * beta_1
+                k += 1;
+            }
+        }
+
+        Square(Result, eta);
+    }
+
+    // A = A ^ -1
+    static inline void InverseAssign(ElementType& A) {
+        Inverse(A, A);
+    }
+
+    // Result = A ^ 2
+    static inline void Square(ElementType& Result, const ElementType& A) noexcept {
+        Reduction::Square(Result, A);
+    }
+
+    // A = A ^ 2
+    static inline void SquareAssign(ElementType& A) noexcept {
+        Reduction::Square(A, A);
+    }
+
+    // Result = sqrt(A)
+    // With A = A_even(x ^ 2) + x * A_odd(x ^ 2), sqrt(A) = A_even(x) + sqrt(x) * A_odd(x).
+    static inline void SquareRoot(ElementType& Result, const ElementType& A) noexcept {
+        ElementType Even = {};
+        ElementType Odd = {};
+
+        for (size_t w = 0; w < WordCountValue; ++w) {
+            uint64_t e = 0;
+            uint64_t o = 0;
+
+            for (size_t b = 0; b < 8; ++b) {
+                uint8_t Nibbles = Reduction::Tables.Compress[A.Words[w] >> 8 * b & 0xff];
+                e |= static_cast<uint64_t>(Nibbles & 0xf) << 4 * b;
+                o |= static_cast<uint64_t>(Nibbles >> 4) << 4 * b;
+            }
+
+            Even.Words[w / 2] |= e << 32 * (w % 2);
+            Odd.Words[w / 2] |= o << 32 * (w % 2);
+        }
+
+        Multiply(Result, Odd, SquareRootOfX);
+        AddAssign(Result, Even);
+    }
+
+    // A = sqrt(A)
+    static inline void SquareRootAssign(ElementType& A) noexcept {
+        SquareRoot(A, A);
+    }
+
+    // Results[i] = As[i] * Bs[i]    where 0 <= i < Count
+    static void MultiplyN(ElementType Results[], const ElementType As[], const ElementType Bs[], size_t Count) noexcept {
+        auto Kernel = VisualAssistDispatch::Get().Polynomial.Multiply;
+
+        for (size_t i = 0; i < Count; ++i) {
+            ProductType c;
+            Kernel(c.Words, As[i].Words, Bs[i].Words, WordCountValue);
+            Reduction::Reduce(Results[i], c);
+        }
+    }
+
+    // Results[i] = As[i] ^ 2    where 0 <= i < Count
+    static void SquareN(ElementType Results[], const ElementType As[], size_t Count) noexcept {
+        for (size_t i = 0; i < Count; ++i) {
+            Square(Results[i], As[i]);
+        }
+    }
+
+    // Results[i] = As[i] ^ -1    where 0 <= i < Count
+    static void InverseN(ElementType Results[], const ElementType As[], size_t Count) {
+        for (size_t i = 0; i < Count; ++i) {
+            Inverse(Results[i], As[i]);
+        }
+    }
+
+    // Batches up to this size take no heap allocation in `BatchInverse`.
+    static constexpr size_t BatchInverseStackCount = 64;
+
+    // Results[i] = As[i] ^ -1    where 0 <= i < Count, `Results` may be the same array as `As`
+    // See `VisualAssistFieldTraitsBase::BatchInverse`.
+    static void BatchInverse(ElementType Results[], const ElementType As[], size_t Count) {
+        if (Count == 0) {
+            return;
+        }
+
+        ElementType StackPrefixes[BatchInverseStackCount];
+        std::unique_ptr<ElementType[]> HeapPrefixes(Count > BatchInverseStackCount ? new ElementType[Count] : nullptr);
+        ElementType* Prefixes = HeapPrefixes ? HeapPrefixes.get() : StackPrefixes;
+
+        Prefixes[0] = As[0];
+        if (IsZero(Prefixes[0])) {
+            SetOne(Prefixes[0]);
+        }
+
+        for (size_t i = 1; i < Count; ++i) {
+            if (IsZero(As[i])) {
+                Prefixes[i] = Prefixes[i - 1];
+            } else {
+                Multiply(Prefixes[i], Prefixes[i - 1], As[i]);
+            }
+        }
+
+        ElementType InversePrefix;
+        Inverse(InversePrefix, Prefixes[Count - 1]);
+
+        for (size_t i = Count - 1; i > 0; --i) {
+            if (IsZero(As[i])) {
+                SetZero(Results[i]);
+            } else {
+                ElementType a = As[i];
+                Multiply(Results[i], Prefixes[i - 1], InversePrefix);
+                MultiplyAssign(InversePrefix, a);
+            }
+        }
+
+        if (IsZero(As[0])) {
+            SetZero(Results[0]);
+        } else {
+            Results[0] = InversePrefix;
+        }
+    }
+
+    // Result = tr(A)
+    // tr is linear, so tr(A) is the parity of A's bits selected by `TraceMask`.
+    static inline void Trace(TraceType& Result, const ElementType& A) {
+        uint64_t x = 0;
+        for (size_t w = 0; w < WordCountValue; ++w) {
+            x ^= A.Words[w] & TraceMask.Words[w];
+        }
+
+        x ^= x >> 32;
+        x ^= x >> 16;
+        x ^= x >> 8;
+        x ^= x >> 4;
+        x ^= x >> 2;
+        x ^= x >> 1;
+
+        Result = static_cast<TraceType>(x & 1);
+    }
+
+    // Find a `z` which satisfies `z^2 + z = Beta`, the other one is `z + 1`
+    // For odd M, the half trace z = sum(Beta ^ (4 ^ i)), 0 <= i <= (M - 1) / 2, is a solution whenever tr(Beta) = 0.
+    [[nodiscard]]
+    static inline bool SolveQuadratic(ElementType& Element, const ElementType& Beta) {
+        static_assert(__M % 2 == 1, "The half trace is defined for odd M only.");
+
+        TraceType tr;
+        Trace(tr, Beta);
+
+        if (tr == 1) {
+            return false;
+        } else {
+            ElementType z = Beta;
+
+            for (size_t i = 0; i < (__M - 1) / 2; ++i) {
+                SquareAssign(z);
+                SquareAssign(z);
+                AddAssign(z, Beta);         // Horner's rule
+            }
+
+            Element = z;
+            return true;
+        }
+    }
+
+    // Find root `x`s which satisfies `A * x ^ 2 + B * x + C = 0`
+    // Roots are written to `Roots`, and the number of roots, 0, 1 or 2, is returned.
+    [[nodiscard]]
+    static inline size_t SolveQuadratic(ElementType (&Roots)[2], const ElementType& A, const ElementType& B, const ElementType& C) {
+        if (IsZero(A)) {
+            throw std::invalid_argument("A cannot be zero.");
+        }
+
+        if (IsZero(B)) {
+            // A * x ^ 2 + C = 0
+            //  x = sqrt(C / A)
+            Divide(Roots[0], C, A);
+            SquareRootAssign(Roots[0]);
+
+            return 1;
+        } else {
+            // See `VisualAssistFieldTraitsBase::SolveQuadratic`
+            ElementType BB;
+            ElementType InverseOfABB;
+            ElementType beta;
+            ElementType BOverA;
+
+            Square(BB, B);
+            Multiply(InverseOfABB, A, BB);
+            InverseAssign(InverseOfABB);
+
+            Multiply(beta, A, C);
+            MultiplyAssign(beta, A);
+            MultiplyAssign(beta, InverseOfABB);     // beta = A ^ 2 * C / (A * B ^ 2)
+
+            Multiply(BOverA, BB, B);
+            MultiplyAssign(BOverA, InverseOfABB);   // B / A = B ^ 3 / (A * B ^ 2)
+
+            if (SolveQuadratic(Roots[0], beta)) {
+                MultiplyAssign(Roots[0], BOverA);
+                Add(Roots[1], Roots[0], BOverA);
+
+                return 2;
+            } else {
+                return 0;
+            }
+        }
+    }
+};
@@ -0,0 +1,114 @@
+#pragma once
+#include <stdint.h>
+#include "Intrinsics.hpp"
+
+#if !defined(_MSC_VER)
+#include <cpuid.h>
+#endif
+
+// Instruction set extensions available on the running processor, detected once by CPUID.
+struct ProcessorFeatures {
+private:
+
+    struct Snapshot {
+        bool Ssse3;
+        bool Pclmulqdq;
+        bool Avx2;
+        bool Avx512F;
+        bool Gfni;
+        bool Vpclmulqdq;
+    };
+
+    static void Cpuid(int Info[4], int Leaf, int SubLeaf) noexcept {
+#if defined(_MSC_VER)
+        __cpuidex(Info, Leaf, SubLeaf);
+#else
+        __cpuid_count(Leaf, SubLeaf, Info[0], Info[1], Info[2], Info[3]);
+#endif
+    }
+
+    // Only valid if OSXSAVE is set.
+    [[nodiscard]]
+    static uint64_t Xgetbv(uint32_t Index) noexcept {
+#if defined(_MSC_VER)
+        return _xgetbv(Index);
+#else
+        // `_xgetbv` of GCC and Clang needs -mxsave
+        uint32_t Low, High;
+        __asm__ volatile ("xgetbv" : "=a"(Low), "=d"(High) : "c"(Index));
+        return static_cast<uint64_t>(High) << 32 | Low;
+#endif
+    }
+
+    [[nodiscard]]
+    static Snapshot Detect() noexcept {
+        Snapshot Features = {};
+        int Info[4];
+
+        Cpuid(Info, 0, 0);
+        int MaxLeaf = Info[0];
+
+        if (MaxLeaf >= 1) {
+            Cpuid(Info, 1, 0);
+            Features.Ssse3 = (Info[2] >> 9 & 1) != 0;
+            Features.Pclmulqdq = (Info[2] >> 1 & 1) != 0;
+
+            // AVX state must be enabled by OS
+            bool OsXsave = (Info[2] >> 27 & 1) != 0;
+            bool Avx = (Info[2] >> 28 & 1) != 0;
+            uint64_t Xcr0 = OsXsave ? Xgetbv(0) : 0;
+
+            bool OsYmm = (Xcr0 & 0x06) == 0x06;     // XMM, YMM
+            bool OsZmm = (Xcr0 & 0xe6) == 0xe6;     // XMM, YMM, opmask, ZMM_Hi256, Hi16_ZMM
+
+            if (MaxLeaf >= 7) {
+                Cpuid(Info, 7, 0);
+                Features.Avx2 = Avx && OsYmm && (Info[1] >> 5 & 1) != 0;
+                Features.Avx512F = Avx && OsZmm && (Info[1] >> 16 & 1) != 0;
+                Features.Gfni = (Info[2] >> 8 & 1) != 0;
+                Features.Vpclmulqdq = Avx && OsYmm && (Info[2] >> 10 & 1) != 0;     // 256-bit form needs AVX
+            }
+        }
+
+        return Features;
+    }
+
+    [[nodiscard]]
+    static const Snapshot& Get() noexcept {
+        static const Snapshot Features = Detect();
+        return Features;
+    }
+
+public:
+
+    [[nodiscard]]
+    static bool HasSsse3() noexcept {
+        return Get().Ssse3;
+    }
+
+    [[nodiscard]]
+    static bool HasPclmulqdq() noexcept {
+        return Get().Pclmulqdq;
+    }
+
+    [[nodiscard]]
+    static bool HasAvx2() noexcept {
+        return Get().Avx2;
+    }
+
+    [[nodiscard]]
+    static bool HasAvx512F() noexcept {
+        return Get().Avx512F;
+    }
+
+    [[nodiscard]]
+    static bool HasGfni() noexcept {
+        return Get().Gfni;
+    }
+
+    [[nodiscard]]
+    static bool HasVpclmulqdq() noexcept {
+        return Get().Vpclmulqdq;
+    }
+};
+
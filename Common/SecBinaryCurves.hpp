@@ -0,0 +1,138 @@
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+#include <vector>
+#include <stdexcept>
+#include "BigInteger.hpp"
+#include "GaloisField.hpp"
+#include "EllipticCurveGF2m.hpp"
+#include "PolynomialBasisFieldTraits.hpp"
+
+// Koblitz curves y^2 + xy = x^3 + Ax^2 + B over GF(2^M) in polynomial basis, see `PolynomialBasisFieldTraits`.
+// SEC 2: Recommended Elliptic Curve Domain Parameters, version 2.0
+//     3.2 Recommended Parameters over F_2^m
+// Field elements are written as in SEC 2, i.e. big endian hexadecimal.
+struct SecBinaryCurves {
+private:
+
+    template<typename __FieldType>
+    static __FieldType ParseElement(const char* lpszHex) {
+        auto Digit = [](char c) -> uint8_t {
+            if ('0' <= c && c <= '9') {
+                return static_cast<uint8_t>(c - '0');
+            } else if ('A' <= c && c <= 'F') {
+                return static_cast<uint8_t>(c - 'A' + 10);
+            } else if ('a' <= c && c <= 'f') {
+                return static_cast<uint8_t>(c - 'a' + 10);
+            } else {
+                throw std::invalid_argument("Not a hexadecimal digit.");
+            }
+        };
+
+        size_t cchHex = 0;
+        while (lpszHex[cchHex]) {
+            ++cchHex;
+        }
+
+        if (cchHex % 2 != 0) {
+            throw std::invalid_argument("Odd number of hexadecimal digits.");
+        }
+
+        std::vector<uint8_t> Bytes(cchHex / 2);
+        for (size_t i = 0; i < Bytes.size(); ++i) {
+            Bytes[Bytes.size() - 1 - i] = static_cast<uint8_t>(Digit(lpszHex[2 * i]) << 4 | Digit(lpszHex[2 * i + 1]));     // to little endian
+        }
+
+        return __FieldType(GaloisFieldInitByBinary{}, Bytes);
+    }
+
+public:
+
+    // f(x) = x^163 + x^7 + x^6 + x^3 + 1, A = 1, B = 1
+    struct Sect163k1 {
+        using FieldTraits = PolynomialBasisFieldTraits<163, ReductionPolynomial<7, 6, 3>>;
+        using FieldType = GaloisField<FieldTraits>;
+
+        static inline const BigInteger Order = "0x4000000000000000000020108A2E0CC0D99F8A5EF";
+
+        static inline const BigInteger Cofactor = 2;
+
+        static inline const EllipticCurveGF2m<FieldType> Curve{
+            FieldType{ GaloisFieldInitByOne{} },
+            FieldType{ GaloisFieldInitByOne{} },
+            Order,
+            Cofactor
+        };
+
+        static inline const EllipticCurveGF2m<FieldType>::Point G = Curve.CreatePoint(
+            ParseElement<FieldType>("02FE13C0537BBC11ACAA07D793DE4E6D5E5C94EEE8"),
+            ParseElement<FieldType>("0289070FB05D38FF58321F2E800536D538CCDAA3D9")
+        );
+    };
+
+    // f(x) = x^233 + x^74 + 1, A = 0, B = 1
+    struct Sect233k1 {
+        using FieldTraits = PolynomialBasisFieldTraits<233, ReductionPolynomial<74>>;
+        using FieldType = GaloisField<FieldTraits>;
+
+        static inline const BigInteger Order = "0x8000000000000000000000000000069D5BB915BCD46EFB1AD5F173ABDF";
+
+        static inline const BigInteger Cofactor = 4;
+
+        static inline const EllipticCurveGF2m<FieldType> Curve{
+            FieldType{ GaloisFieldInitByZero{} },
+            FieldType{ GaloisFieldInitByOne{} },
+            Order,
+            Cofactor
+        };
+
+        static inline const EllipticCurveGF2m<FieldType>::Point G = Curve.CreatePoint(
+            ParseElement<FieldType>("017232BA853A7E731AF129F22FF4149563A419C26BF50A4C9D6EEFAD6126"),
+            ParseElement<FieldType>("01DB537DECE819B7F70F555A67C427A8CD9BF18AEB9B56E0C11056FAE6A3")
+        );
+    };
+
+    // f(x) = x^283 + x^12 + x^7 + x^5 + 1, A = 0, B = 1
+    struct Sect283k1 {
+        using FieldTraits = PolynomialBasisFieldTraits<283, ReductionPolynomial<12, 7, 5>>;
+        using FieldType = GaloisField<FieldTraits>;
+
+        static inline const BigInteger Order = "0x1FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFE9AE2ED07577265DFF7F94451E061E163C61";
+
+        static inline const BigInteger Cofactor = 4;
+
+        static inline const EllipticCurveGF2m<FieldType> Curve{
+            FieldType{ GaloisFieldInitByZero{} },
+            FieldType{ GaloisFieldInitByOne{} },
+            Order,
+            Cofactor
+        };
+
+        static inline const EllipticCurveGF2m<FieldType>::Point G = Curve.CreatePoint(
+            ParseElement<FieldType>("0503213F78CA44883F1A3B8162F188E553CD265F23C1567A16876913B0C2AC2458492836"),
+            ParseElement<FieldType>("01CCDA380F1C9E318D90F95D07E5426FE87E45C0E8184698E45962364E34116177DD2259")
+        );
+    };
+
+    // f(x) = x^409 + x^87 + 1, A = 0, B = 1
+    struct Sect409k1 {
+        using FieldTraits = PolynomialBasisFieldTraits<409, ReductionPolynomial<87>>;
+        using FieldType = GaloisField<FieldTraits>;
+
+        static inline const BigInteger Order = "0x7FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFE5F83B2D4EA20400EC4557D5ED3E3E7CA5B4B5C83B8E01E5FCF";
+
+        static inline const BigInteger Cofactor = 4;
+
+        static inline const EllipticCurveGF2m<FieldType> Curve{
+            FieldType{ GaloisFieldInitByZero{} },
+            FieldType{ GaloisFieldInitByOne{} },
+            Order,
+            Cofactor
+        };
+
+        static inline const EllipticCurveGF2m<FieldType>::Point G = Curve.CreatePoint(
+            ParseElement<FieldType>("0060F05F658F49C1AD3AB1890F7184210EFD0987E307C84C27ACCFB8F9F67CC2C460189EB5AAAA62EE222EB1B35540CFE9023746"),
+            ParseElement<FieldType>("01E369050B7C4E42ACBA1DACBF04299C3460782F918EA427E6325165E9EA10E3DA5F6C42E9C55215AA9CA27A5863EC48D8E0286B")
+        );
+    };
+};
@@ -0,0 +1,340 @@
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+#include "BigInteger.hpp"
+#include "EllipticCurveGF2m.hpp"
+
+// The curve y^2 + xy = x^3 + Ax^2 + B with A and B fixed at compile time, for A = 0 or 1 and B = 1, i.e. the Koblitz curves like the VA curve.
+// Points don't refer to their curve, so that they are trivially copyable structs of field elements which can live in arrays and registers,
+// and the multiplications by A and B in the group operations fold away.
+// Scalar multiplication borrows the tau-adic parameters of an `EllipticCurveGF2m` with the same A and B.
+template<typename __FieldType, unsigned __A, unsigned __B>
+class StaticCurve {
+public:
+
+    static_assert(__A <= 1 && __B == 1, "Only A = 0 or 1 and B = 1 are supported.");
+
+    using FieldType = __FieldType;
+    using DynamicCurveType = EllipticCurveGF2m<__FieldType>;
+
+    // Affine (x, y), where the infinity point is (0, 0), which is never on the curve as B != 0.
+    struct Point {
+        __FieldType X;
+        __FieldType Y;
+    };
+
+    // Lopez-Dahab projective (X : Y : Z), i.e. (x, y) = (X / Z, Y / Z ^ 2), where the infinity point has Z = 0.
+    struct ProjectivePoint {
+        __FieldType X;
+        __FieldType Y;
+        __FieldType Z;
+    };
+
+    static_assert(std::is_trivially_copyable_v<Point> && sizeof(Point) == 2 * sizeof(__FieldType));
+    static_assert(std::is_trivially_copyable_v<ProjectivePoint> && sizeof(ProjectivePoint) == 3 * sizeof(__FieldType));
+
+private:
+
+    static constexpr size_t MaxPrecomputedCount = size_t{1} << (DynamicCurveType::MaxNafWidth - 2);
+
+    // K0 * P + K1 * tau(P) for small K0 and K1 by one chain of doublings, where P is affine and not the infinity point
+    [[nodiscard]]
+    static ProjectivePoint MultiplyBySmallTauAdic(const Point& P, int64_t K0, int64_t K1) noexcept {
+        Point Terms[2] = { P, Point{ P.X.SquareValue(), P.Y.SquareValue() } };
+        uint64_t k[2] = {
+            K0 < 0 ? 0 - static_cast<uint64_t>(K0) : static_cast<uint64_t>(K0),
+            K1 < 0 ? 0 - static_cast<uint64_t>(K1) : static_cast<uint64_t>(K1)
+        };
+
+        if (K0 < 0) {
+            Negate(Terms[0]);
+        }
+
+        if (K1 < 0) {
+            Negate(Terms[1]);
+        }
+
+        ProjectivePoint Result = GetInfinityProjectivePoint();
+
+        for (size_t i = 64; i-- > 0;) {
+            Double(Result);
+            for (size_t j = 0; j < 2; ++j) {
+                if (k[j] >> i & 1) {
+                    AddAffine(Result, Terms[j]);
+                }
+            }
+        }
+
+        return Result;
+    }
+
+public:
+
+    // The curve with the same A and B, and no order, whose points convert to and from this one's.
+    [[nodiscard]]
+    static const DynamicCurveType& GetDynamicCurve() {
+        static const DynamicCurveType Curve(GetParameterA(), GetParameterB());
+        return Curve;
+    }
+
+    [[nodiscard]]
+    static __FieldType GetParameterA() noexcept {
+        if constexpr (__A == 0) {
+            return __FieldType::GetValueOfZero();
+        } else {
+            return __FieldType::GetValueOfOne();
+        }
+    }
+
+    [[nodiscard]]
+    static __FieldType GetParameterB() noexcept {
+        return __FieldType::GetValueOfOne();
+    }
+
+    [[nodiscard]]
+    static Point GetInfinityPoint() noexcept {
+        return Point{ __FieldType::GetValueOfZero(), __FieldType::GetValueOfZero() };
+    }
+
+    [[nodiscard]]
+    static ProjectivePoint GetInfinityProjectivePoint() noexcept {
+        return ProjectivePoint{ __FieldType::GetValueOfZero(), __FieldType::GetValueOfZero(), __FieldType::GetValueOfZero() };
+    }
+
+    [[nodiscard]]
+    static bool IsAtInfinity(const Point& P) noexcept {
+        return P.X.IsZero() && P.Y.IsZero();
+    }
+
+    [[nodiscard]]
+    static bool IsAtInfinity(const ProjectivePoint& P) noexcept {
+        return P.Z.IsZero();
+    }
+
+    // y^2 + xy = x^3 + Ax^2 + B, or the infinity point
+    [[nodiscard]]
+    static bool IsOnCurve(const Point& P) noexcept {
+        if (IsAtInfinity(P)) {
+            return true;
+        }
+
+        auto Left = P.Y.SquareValue() + P.X * P.Y;
+        auto Right = P.X.SquareValue();
+        if constexpr (__A == 1) {
+            Right *= P.X + __FieldType::GetValueOfOne();
+        } else {
+            Right *= P.X;
+        }
+        Right.AddOne();
+
+        return Left == Right;
+    }
+
+    [[nodiscard]]
+    static ProjectivePoint ToProjective(const Point& P) noexcept {
+        if (IsAtInfinity(P)) {
+            return GetInfinityProjectivePoint();
+        } else {
+            return ProjectivePoint{ P.X, P.Y, __FieldType::GetValueOfOne() };
+        }
+    }
+
+    // One inversion, unless Z is 0 or 1
+    [[nodiscard]]
+    static Point ToAffine(const ProjectivePoint& P) noexcept {
+        if (P.Z.IsZero()) {
+            return GetInfinityPoint();
+        } else if (P.Z.IsOne()) {
+            return Point{ P.X, P.Y };
+        } else {
+            auto InverseOfZ = P.Z.InverseValue();
+            return Point{ P.X * InverseOfZ, P.Y * InverseOfZ.Square() };
+        }
+    }
+
+    // Points[i] to affine by one inversion for all of them
+    static void ToAffineN(Point Results[], const ProjectivePoint Points[], size_t Count) {
+        std::vector<__FieldType> InverseOfZ(Count);
+
+        for (size_t i = 0; i < Count; ++i) {
+            InverseOfZ[i] = Points[i].Z;
+        }
+
+        __FieldType::BatchInverse(InverseOfZ.data(), Count);
+
+        for (size_t i = 0; i < Count; ++i) {
+            if (Points[i].Z.IsZero()) {
+                Results[i] = GetInfinityPoint();
+            } else {
+                Results[i].X = Points[i].X * InverseOfZ[i];
+                Results[i].Y = Points[i].Y * InverseOfZ[i].Square();
+            }
+        }
+    }
+
+    // -(x, y) = (x, x + y)
+    static void Negate(Point& P) noexcept {
+        P.Y += P.X;
+    }
+
+    // -(X : Y : Z) = (X : X * Z + Y : Z)
+    static void Negate(ProjectivePoint& P) noexcept {
+        P.Y += P.X * P.Z;
+    }
+
+    // 3M + 5S, where A and B cost an addition at most
+    // Hankerson, Menezes, Vanstone. Guide to Elliptic Curve Cryptography. Algorithm 3.24
+    static void Double(ProjectivePoint& P) noexcept {
+        if (P.Z.IsZero()) {
+            return;
+        }
+
+        auto XX = P.X.SquareValue();
+        auto ZZZZ = P.Z.SquareValue();
+        P.Z = XX * ZZZZ;                // Z3 = X1 ^ 2 * Z1 ^ 2
+        ZZZZ.Square();                  // b * Z1 ^ 4 = Z1 ^ 4
+
+        // X3 = X1 ^ 4 + b * Z1 ^ 4
+        P.X = XX.Square();
+        P.X += ZZZZ;
+
+        // Y3 = b * Z1 ^ 4 * Z3 + X3 * (a * Z3 + Y1 ^ 2 + b * Z1 ^ 4)
+        P.Y.Square();
+        P.Y += ZZZZ;
+        if constexpr (__A == 1) {
+            P.Y += P.Z;
+        }
+        P.Y *= P.X;
+        P.Y += ZZZZ * P.Z;
+    }
+
+    // P += Q with Q affine, 8M + 5S, where A costs an addition at most
+    // Hankerson, Menezes, Vanstone. Guide to Elliptic Curve Cryptography. Algorithm 3.25
+    static void AddAffine(ProjectivePoint& P, const Point& Q) noexcept {
+        if (IsAtInfinity(Q)) {
+            return;
+        }
+
+        if (P.Z.IsZero()) {
+            P = ToProjective(Q);
+            return;
+        }
+
+        auto ZZ = P.Z.SquareValue();
+        auto A = Q.Y * ZZ + P.Y;        // A = Y2 * Z1 ^ 2 + Y1
+        auto B = Q.X * P.Z + P.X;       // B = X2 * Z1 + X1
+
+        if (B.IsZero()) {
+            if (A.IsZero()) {
+                Double(P);
+            } else {
+                P = GetInfinityProjectivePoint();
+            }
+            return;
+        }
+
+        auto C = P.Z * B;               // C = Z1 * B
+        auto E = A * C;                 // E = A * C
+
+        // Z3 = C ^ 2
+        P.Z = C.SquareValue();
+
+        // X3 = A ^ 2 + B ^ 2 * (C + a * Z1 ^ 2) + E
+        if constexpr (__A == 1) {
+            C += ZZ;
+        }
+        P.X = A.Square();
+        P.X += B.Square() * C;
+        P.X += E;
+
+        // Y3 = (E + Z3) * (X3 + X2 * Z3) + (X2 + Y2) * Z3 ^ 2
+        E += P.Z;
+        P.Y = Q.X * P.Z;
+        P.Y += P.X;
+        P.Y *= E;
+        P.Y += (Q.X + Q.Y) * P.Z.SquareValue();
+    }
+
+    // tau(X : Y : Z) = (X^2 : Y^2 : Z^2)
+    static void Frobenius(ProjectivePoint& P) noexcept {
+        P.X.Square();
+        P.Y.Square();
+        P.Z.Square();
+    }
+
+    // P + Q, which takes an inversion
+    [[nodiscard]]
+    static Point Add(const Point& P, const Point& Q) noexcept {
+        auto R = ToProjective(P);
+        AddAffine(R, Q);
+        return ToAffine(R);
+    }
+
+    // N * P by the width-w tau-adic NAF of N, the same as `EllipticCurveGF2m::Point::MultiplyByTauAdicNaf`.
+    // Hankerson, Menezes, Vanstone. Guide to Elliptic Curve Cryptography. Algorithm 3.70
+    template<typename __ScalarType>
+    [[nodiscard]]
+    static Point Multiply(const Point& P, const __ScalarType& N) {
+        if (N.IsZero() || IsAtInfinity(P)) {
+            return GetInfinityPoint();
+        }
+
+        const auto& Curve = GetDynamicCurve();
+        const auto& T = Curve.m_TauAdic;
+        auto Digits = Curve.TauAdicRecode(ToBigInteger(N), BigInteger());
+
+        size_t Count = size_t{1} << (T.Width - 2);
+
+        ProjectivePoint Alphas[MaxPrecomputedCount];
+        Point AffineAlphas[MaxPrecomputedCount];
+
+        // alpha_u * P = r0 * P + r1 * tau(P)
+        for (size_t i = 0; i < Count; ++i) {
+            Alphas[i] = MultiplyBySmallTauAdic(P, T.Alphas[i][0], T.Alphas[i][1]);
+        }
+
+        ToAffineN(AffineAlphas, Alphas, Count);
+
+        ProjectivePoint Result = GetInfinityProjectivePoint();
+
+        for (size_t i = Digits.size(); i-- > 0;) {
+            Frobenius(Result);
+
+            int Digit = Digits[i];
+            if (Digit > 0) {
+                AddAffine(Result, AffineAlphas[Digit / 2]);
+            } else if (Digit < 0) {
+                Point Alpha = AffineAlphas[-Digit / 2];
+                Negate(Alpha);
+                AddAffine(Result, Alpha);
+            }
+        }
+
+        return ToAffine(Result);
+    }
+
+    // The point of an `EllipticCurveGF2m` with the same A and B
+    [[nodiscard]]
+    static Point FromDynamic(const typename DynamicCurveType::Point& P) {
+        if (P.m_Curve.m_A != GetParameterA() || P.m_Curve.m_B != GetParameterB()) {
+            throw std::invalid_argument("Not on the same curve.");
+        }
+
+        Point Result;
+        P.GetAffine(Result.X, Result.Y);
+        return Result;
+    }
+
+    // P on Curve, which must have the same A and B
+    [[nodiscard]]
+    static typename DynamicCurveType::Point ToDynamic(const DynamicCurveType& Curve, const Point& P) {
+        if (Curve.GetParameterA() != GetParameterA() || Curve.GetParameterB() != GetParameterB()) {
+            throw std::invalid_argument("Not on the same curve.");
+        }
+
+        return Curve.CreatePoint(P.X, P.Y);
+    }
+};
@@ -0,0 +1,71 @@
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+#include <stdexcept>
+#include <vector>
+
+// A point of order n, e.g. a public key, checked once when it comes in so that code taking one never checks it again:
+// it is on the curve, not the infinity point, and in the subgroup of order n.
+// With the cofactor h = 2 the subgroup check is a trace, see `EllipticCurveGF2m::Point::IsInPrimeOrderSubgroup`,
+// so that validating a key costs a few field operations instead of a scalar multiplication.
+template<typename __CurveType>
+class ValidatedPoint {
+public:
+
+    using PointType = typename __CurveType::Point;
+
+private:
+
+    PointType m_Point;
+
+    struct Unchecked {};
+
+    ValidatedPoint(Unchecked, const PointType& P) noexcept :
+        m_Point(P) {}
+
+    [[nodiscard]]
+    static bool IsValid(const PointType& P) {
+        return P.IsAtInfinity() == false && P.IsInPrimeOrderSubgroup();
+    }
+
+public:
+
+    // Throws if P is not of order n. P is on its curve already, as `EllipticCurveGF2m::Point` is never made off the curve.
+    explicit ValidatedPoint(const PointType& P) :
+        m_Point(P)
+    {
+        if (IsValid(m_Point) == false) {
+            throw std::invalid_argument("Point is not of order n.");
+        }
+    }
+
+    // Count points in the compressed SEC 1 form, decompressed by `EllipticCurveGF2m::LoadCompressedN` with one inversion for many of them.
+    // Throws if any of them is malformed or not of order n.
+    [[nodiscard]]
+    static std::vector<ValidatedPoint> LoadCompressedN(const __CurveType& Curve, const void* lpBytes, size_t Count) {
+        std::vector<PointType> Points(Count, PointType(Curve));
+        Curve.LoadCompressedN(Points.data(), lpBytes, Count);
+
+        std::vector<ValidatedPoint> Results;
+        Results.reserve(Count);
+
+        for (const auto& P : Points) {
+            if (IsValid(P) == false) {
+                throw std::invalid_argument("Point is not of order n.");
+            }
+            Results.emplace_back(ValidatedPoint(Unchecked{}, P));
+        }
+
+        return Results;
+    }
+
+    [[nodiscard]]
+    const PointType& Get() const noexcept {
+        return m_Point;
+    }
+
+    [[nodiscard]]
+    operator const PointType&() const noexcept {
+        return m_Point;
+    }
+};
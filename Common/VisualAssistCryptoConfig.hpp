@@ -1,8 +1,10 @@
 #pragma once
 #include "BigInteger.hpp"
+#include "FixedUInt.hpp"
 #include "GaloisField.hpp"
 #include "EllipticCurveGF2m.hpp"
-#include "VisualAssistFieldTraits.hpp"
+#include "StaticCurve.hpp"
+#include "VisualAssistFieldDispatchTraits.hpp"
 #include "VisualAssistRandomGenerator.hpp"
 
 #include "Hasher.hpp"
@@ -12,9 +14,9 @@
 struct VisualAssistCryptoConfig {
 private:
 
-    static EllipticCurveGF2m<GaloisField<VisualAssistFieldTraits>>::Point GenerateBasePoint(uint32_t Seed) {
+    static EllipticCurveGF2m<GaloisField<VisualAssistFieldDispatchTraits>>::Point GenerateBasePoint(uint32_t Seed) {
         VisualAssistRandomGenerator Rnd(Seed);
-        GaloisField<VisualAssistFieldTraits> RandomFieldValue;
+        GaloisField<VisualAssistFieldDispatchTraits> RandomFieldValue;
         uint32_t RawRandomFieldValue[4];
 
         RawRandomFieldValue[3] = Rnd.NextRandomNumber() & 0x1ffff;
@@ -35,8 +37,8 @@ private:
             t *= RandomFieldValue.SquareValue();
             t += Curve.GetParameterB();
 
-            auto Roots = GaloisField<VisualAssistFieldTraits>::SolveQuadratic({ GaloisFieldInitByOne{} }, RandomFieldValue, t);
-            if (Roots.size() != 2) {
+            GaloisField<VisualAssistFieldDispatchTraits> Roots[2];
+            if (GaloisField<VisualAssistFieldDispatchTraits>::SolveQuadratic(Roots, { GaloisFieldInitByOne{} }, RandomFieldValue, t) != 2) {
                 ++RawRandomFieldValue[0];
                 continue;
             }
@@ -45,7 +47,7 @@ private:
         }
     }
 
-    static std::string GeneratePublicKeyString(uint32_t BasePointGenerator, const EllipticCurveGF2m<GaloisField<VisualAssistFieldTraits>>::Point& PublicKey) {
+    static std::string GeneratePublicKeyString(uint32_t BasePointGenerator, const EllipticCurveGF2m<GaloisField<VisualAssistFieldDispatchTraits>>::Point& PublicKey) {
         BigInteger Px(false, PublicKey.GetX().Serialize(), BigIntegerEndian::Little);
         BigInteger Py(false, PublicKey.GetY().Serialize(), BigIntegerEndian::Little);
         return std::to_string(BasePointGenerator)
@@ -70,15 +72,25 @@ private:
 
 public:
 
-    static inline const EllipticCurveGF2m<GaloisField<VisualAssistFieldTraits>> Curve{
-        GaloisField<VisualAssistFieldTraits>{ GaloisFieldInitByOne{} },
-        GaloisField<VisualAssistFieldTraits>{ GaloisFieldInitByOne{} },
-    };
-
     static inline const BigInteger Order = "0xfffffffffffffffdbf91af6dea73";
 
     static inline const BigInteger Cofactor = 2;
 
+    // Scalars and values mod n in signing and verification, wide enough for the product of two values mod n before it is reduced
+    using ScalarType = FixedUInt<256>;
+
+    static inline const ScalarType ScalarOrder{ Order };
+
+    static inline const EllipticCurveGF2m<GaloisField<VisualAssistFieldDispatchTraits>> Curve{
+        GaloisField<VisualAssistFieldDispatchTraits>{ GaloisFieldInitByOne{} },
+        GaloisField<VisualAssistFieldDispatchTraits>{ GaloisFieldInitByOne{} },
+        Order,
+        Cofactor
+    };
+
+    // The same curve with A = B = 1 folded in, whose points are plain pairs of field elements
+    using StaticCurveType = StaticCurve<GaloisField<VisualAssistFieldDispatchTraits>, 1, 1>;
+
     static inline const size_t NumberOfKeys = 2;
 
     struct Official {
@@ -93,7 +105,7 @@ public:
             4065234961
         };
 
-        static inline const EllipticCurveGF2m<GaloisField<VisualAssistFieldTraits>>::Point G[] = {
+        static inline const EllipticCurveGF2m<GaloisField<VisualAssistFieldDispatchTraits>>::Point G[] = {
             GenerateBasePoint(BasePointGenerator[0]),
             GenerateBasePoint(BasePointGenerator[1])
         };
@@ -101,12 +113,12 @@ public:
         //
         // Of course, we don't have :-)
         //
-        // static inline const BigInteger PrivateKey[] = {
+        // static inline const ScalarType PrivateKey[] = {
         //     "",
         //     ""
         // };
 
-        static inline const EllipticCurveGF2m<GaloisField<VisualAssistFieldTraits>>::Point PublicKey[] = {
+        static inline const EllipticCurveGF2m<GaloisField<VisualAssistFieldDispatchTraits>>::Point PublicKey[] = {
             Curve.CreatePoint(
                 { GaloisFieldInitByElement{}, _mm_set_epi32(0x1daa0, 0xd314df6c, 0x689c33e7, 0x6c94a943) }, 
                 { GaloisFieldInitByElement{}, _mm_set_epi32(0x0aac7, 0x0f8ba549, 0xc3beacf6, 0xbd563e16) }
@@ -141,17 +153,17 @@ public:
             2127088620      // Armadillo Encrypt Template = "3"
         };
 
-        static inline const EllipticCurveGF2m<GaloisField<VisualAssistFieldTraits>>::Point G[] = {
+        static inline const EllipticCurveGF2m<GaloisField<VisualAssistFieldDispatchTraits>>::Point G[] = {
             GenerateBasePoint(BasePointGenerator[0]),
             GenerateBasePoint(BasePointGenerator[1])
         };
 
-        static inline const BigInteger PrivateKey[] = {
+        static inline const ScalarType PrivateKey[] = {
             "0x2def66c7f63c047c2e7af50b55e6",       // 0x2def66c7f63c047c2e7aad777e6e + 0x000000004793d778
             "0x2def66c7f63c047c2e7ca2948191"        // 0x2def66c7f63c047c2e7aad777e6e + 0x00000001f51d0323
         };
 
-        static inline const EllipticCurveGF2m<GaloisField<VisualAssistFieldTraits>>::Point PublicKey[] = {
+        static inline const EllipticCurveGF2m<GaloisField<VisualAssistFieldDispatchTraits>>::Point PublicKey[] = {
             G[0] * PrivateKey[0],
             G[1] * PrivateKey[1]
         };
@@ -0,0 +1,225 @@
+#include "VisualAssistDispatch.hpp"
+#include "ProcessorFeatures.hpp"
+#include "VisualAssistFieldTraits.hpp"
+#include "VisualAssistFieldLanes.hpp"
+#include <string.h>
+
+namespace {
+
+    struct Sse2FieldKernel {
+        using LaneKernel = VisualAssistFieldLaneKernel<VisualAssistFieldLanesSse2, VisualAssistFieldTraits>;
+
+        static void Multiply(__m128i& Result, const __m128i& A, const __m128i& B) noexcept {
+            VisualAssistFieldTraits::Multiply(Result, A, B);
+        }
+
+        // Ning-Yin's prepared multiplier takes 113 elements, it doesn't pay off for a single multiplication.
+        static void Prepare(VisualAssistDispatch::FieldPreparedType& Prepared, const __m128i& B) noexcept {
+            Prepared.Multiplier = B;
+        }
+
+        static void MultiplyPrepared(__m128i& Result, const __m128i& A, const VisualAssistDispatch::FieldPreparedType& B) noexcept {
+            VisualAssistFieldTraits::Multiply(Result, A, B.Multiplier);
+        }
+
+        static void MultiplyN(__m128i Results[], const __m128i As[], const __m128i Bs[], size_t Count) noexcept {
+            LaneKernel::MultiplyN(Results, As, Bs, Count);
+        }
+
+        static void SquareN(__m128i Results[], const __m128i As[], size_t Count) noexcept {
+            LaneKernel::SquareN(Results, As, Count);
+        }
+
+        static void InverseN(__m128i Results[], const __m128i As[], size_t Count) noexcept {
+            LaneKernel::InverseN(Results, As, Count);
+        }
+    };
+
+    struct Crc32LookupTable {
+        uint32_t Entries[8][256];
+    };
+
+    // Entries[k][i] is the CRC of byte i followed by k zero bytes.
+    constexpr Crc32LookupTable GenerateCrc32LookupTable() noexcept {
+        Crc32LookupTable Table = {};
+
+        for (uint32_t i = 0; i < 256; ++i) {
+            uint32_t result = i;
+            for (unsigned j = 0; j < 8; ++j) {
+                result = result % 2 ? result / 2 ^ 0xEDB88320 : result / 2;
+            }
+            Table.Entries[0][i] = result;
+        }
+
+        for (size_t k = 1; k < 8; ++k) {
+            for (size_t i = 0; i < 256; ++i) {
+                uint32_t prev = Table.Entries[k - 1][i];
+                Table.Entries[k][i] = prev >> 8 ^ Table.Entries[0][prev & 0xff];
+            }
+        }
+
+        return Table;
+    }
+
+    // Slicing-by-8, 8 bytes are consumed by 8 independent lookups.
+    struct ScalarCrc32Kernel {
+        static constexpr Crc32LookupTable Table = GenerateCrc32LookupTable();
+
+        static uint32_t Update(uint32_t Value, const void* lpData, size_t cbData) noexcept {
+            auto pbData = reinterpret_cast<const uint8_t*>(lpData);
+            auto& T = Table.Entries;
+
+            for (; cbData >= 8; pbData += 8, cbData -= 8) {
+                uint32_t Low, High;
+                memcpy(&Low, pbData, sizeof(Low));      // little endian
+                memcpy(&High, pbData + 4, sizeof(High));
+
+                Low ^= Value;
+                Value =
+                    T[7][Low & 0xff] ^ T[6][Low >> 8 & 0xff] ^ T[5][Low >> 16 & 0xff] ^ T[4][Low >> 24] ^
+                    T[3][High & 0xff] ^ T[2][High >> 8 & 0xff] ^ T[1][High >> 16 & 0xff] ^ T[0][High >> 24];
+            }
+
+            for (; cbData > 0; ++pbData, --cbData) {
+                Value = Value >> 8 ^ T[0][(Value ^ *pbData) & 0xff];
+            }
+
+            return Value;
+        }
+    };
+
+    // 64 x 64 -> 128 bits carry-less multiplication by 4-bit windows of B.
+    // A's top 3 bits are left out of the window table so that its entries fit in 64 bits, they are added at the end.
+    // The table of A[i] is shared by every B[j].
+    struct ScalarPolynomialKernel {
+        struct WindowTable {
+            uint64_t Entries[16];
+            uint64_t Top;           // top 3 bits of A
+        };
+
+        static inline void Prepare(WindowTable& Table, uint64_t A) noexcept {
+            uint64_t a = A & 0x1fffffffffffffff;
+
+            Table.Entries[0] = 0;
+            Table.Entries[1] = a;
+            for (size_t i = 2; i < 16; i += 2) {
+                Table.Entries[i] = Table.Entries[i / 2] << 1;
+                Table.Entries[i + 1] = Table.Entries[i] ^ a;
+            }
+
+            Table.Top = A;
+        }
+
+        static inline void Multiply1x1(uint64_t& Low, uint64_t& High, const WindowTable& A, uint64_t B) noexcept {
+            uint64_t l = A.Entries[B & 0xf];
+            uint64_t h = 0;
+
+            for (unsigned s = 4; s < 64; s += 4) {
+                uint64_t t = A.Entries[B >> s & 0xf];
+                l ^= t << s;
+                h ^= t >> (64 - s);
+            }
+
+            for (unsigned s = 61; s < 64; ++s) {
+                uint64_t Mask = 0 - (A.Top >> s & 1);
+                l ^= B << s & Mask;
+                h ^= B >> (64 - s) & Mask;
+            }
+
+            Low ^= l;
+            High ^= h;
+        }
+
+        static void Multiply(uint64_t Product[], const uint64_t A[], const uint64_t B[], size_t WordCount) noexcept {
+            for (size_t k = 0; k < 2 * WordCount; ++k) {
+                Product[k] = 0;
+            }
+
+            for (size_t i = 0; i < WordCount; ++i) {
+                WindowTable Table;
+                Prepare(Table, A[i]);
+
+                for (size_t j = 0; j < WordCount; ++j) {
+                    Multiply1x1(Product[i + j], Product[i + j + 1], Table, B[j]);
+                }
+            }
+        }
+    };
+
+    // Name follows Multiply, so that batch-only kernels such as AVX2's don't claim the single multiplications.
+    void Merge(VisualAssistDispatch::FieldKernel& Kernel, const VisualAssistDispatch::FieldKernel& Other) noexcept {
+        if (Other.Multiply) {
+            Kernel.Name = Other.Name;
+            Kernel.Multiply = Other.Multiply;
+        }
+        if (Other.Prepare) Kernel.Prepare = Other.Prepare;
+        if (Other.MultiplyPrepared) Kernel.MultiplyPrepared = Other.MultiplyPrepared;
+        if (Other.MultiplyN) Kernel.MultiplyN = Other.MultiplyN;
+        if (Other.SquareN) Kernel.SquareN = Other.SquareN;
+        if (Other.InverseN) Kernel.InverseN = Other.InverseN;
+    }
+
+    VisualAssistDispatch::KernelTable Select() noexcept {
+        VisualAssistDispatch::KernelTable Table = {
+            VisualAssistDispatch::FieldSse2,
+            VisualAssistDispatch::Crc32Scalar,
+            VisualAssistDispatch::PolynomialScalar
+        };
+
+        if (ProcessorFeatures::HasAvx2()) {
+            Merge(Table.Field, VisualAssistDispatch::FieldAvx2);
+        }
+
+        if (ProcessorFeatures::HasAvx512F()) {
+            Merge(Table.Field, VisualAssistDispatch::FieldAvx512);
+        }
+
+        // Squarings are rotations, which the lanes do on 2 or 4 elements at once, about 3 times as fast as one by one.
+        auto SquareN = Table.Field.SquareN;
+
+        if (ProcessorFeatures::HasSsse3() && ProcessorFeatures::HasPclmulqdq()) {
+            Merge(Table.Field, VisualAssistDispatch::FieldPclmulqdq);
+
+            // GFNI's 256-bit VPCLMULQDQ and bit reversal are slower than PCLMULQDQ for one multiplication at a time,
+            // by 5% on an Ice Lake class host, so that single multiplications and inversions stay on PCLMULQDQ.
+            // In batches, which have independent multiplications to overlap, GFNI is as fast at least.
+            if (ProcessorFeatures::HasGfni() && ProcessorFeatures::HasVpclmulqdq() && ProcessorFeatures::HasAvx2()) {
+                Table.Field.MultiplyN = VisualAssistDispatch::FieldGfni.MultiplyN;
+            }
+        }
+
+        Table.Field.SquareN = SquareN;
+
+        if (ProcessorFeatures::HasPclmulqdq()) {
+            Table.Crc32 = VisualAssistDispatch::Crc32Pclmulqdq;
+            Table.Polynomial = VisualAssistDispatch::PolynomialPclmulqdq;
+        }
+
+        return Table;
+    }
+}
+
+const VisualAssistDispatch::FieldKernel VisualAssistDispatch::FieldSse2 = {
+    "SSE2",
+    Sse2FieldKernel::Multiply,
+    Sse2FieldKernel::Prepare,
+    Sse2FieldKernel::MultiplyPrepared,
+    Sse2FieldKernel::MultiplyN,
+    Sse2FieldKernel::SquareN,
+    Sse2FieldKernel::InverseN
+};
+
+const VisualAssistDispatch::Crc32Kernel VisualAssistDispatch::Crc32Scalar = {
+    "Scalar",
+    ScalarCrc32Kernel::Update
+};
+
+const VisualAssistDispatch::PolynomialKernel VisualAssistDispatch::PolynomialScalar = {
+    "Scalar",
+    ScalarPolynomialKernel::Multiply
+};
+
+const VisualAssistDispatch::KernelTable& VisualAssistDispatch::Get() noexcept {
+    static const KernelTable Table = Select();
+    return Table;
+}
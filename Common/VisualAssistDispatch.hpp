@@ -0,0 +1,69 @@
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+#include "Intrinsics.hpp"
+
+// Kernels built for one instruction set each, see VisualAssistDispatch*.cpp.
+// The best ones for the running processor are picked once by CPUID, so callers never need any instruction set flag.
+//
+// Kernel files include the field headers inside an unnamed namespace.
+// Otherwise the linker would be free to keep, say, the AVX2 copy of an inline function for every caller.
+struct VisualAssistDispatch {
+
+    // A GF(2^113) multiplier prepared for many multiplications.
+    // Ning-Yin kernels use `Multiplier` only, carry-less kernels use the palindromic form, see `VisualAssistFieldClmulTraits`.
+    struct FieldPreparedType {
+        __m128i Multiplier;
+        __m128i Palindromic;
+        __m128i Reversed;
+    };
+
+    // GF(2^113) in type 2 ONB, see `VisualAssistFieldTraitsBase`.
+    struct FieldKernel {
+        const char* Name;
+        void (*Multiply)(__m128i& Result, const __m128i& A, const __m128i& B) noexcept;
+        void (*Prepare)(FieldPreparedType& Prepared, const __m128i& B) noexcept;
+        void (*MultiplyPrepared)(__m128i& Result, const __m128i& A, const FieldPreparedType& B) noexcept;
+        void (*MultiplyN)(__m128i Results[], const __m128i As[], const __m128i Bs[], size_t Count) noexcept;
+        void (*SquareN)(__m128i Results[], const __m128i As[], size_t Count) noexcept;
+        void (*InverseN)(__m128i Results[], const __m128i As[], size_t Count) noexcept;
+    };
+
+    // CRC-32 with reflected polynomial 0xEDB88320.
+    // `Value` is the raw register, pre- and post-inversion are left to callers.
+    struct Crc32Kernel {
+        const char* Name;
+        uint32_t (*Update)(uint32_t Value, const void* lpData, size_t cbData) noexcept;
+    };
+
+    // Carry-less product of polynomials over GF(2), see `PolynomialBasisFieldTraits`.
+    // `A` and `B` take `WordCount` 64-bit words each, `Product` takes 2 * `WordCount` words, least significant first.
+    struct PolynomialKernel {
+        const char* Name;
+        void (*Multiply)(uint64_t Product[], const uint64_t A[], const uint64_t B[], size_t WordCount) noexcept;
+    };
+
+    struct KernelTable {
+        FieldKernel Field;
+        Crc32Kernel Crc32;
+        PolynomialKernel Polynomial;
+    };
+
+    // Every kernel, roughly in order of preference. `Get` picks every function by its own measured speed, though,
+    // e.g. single multiplications from PCLMULQDQ but batch multiplications from GFNI, and squarings from AVX-512 or AVX2.
+    // Null functions of a kernel are taken from the next one which is available.
+    static const FieldKernel FieldGfni;         // GFNI, VPCLMULQDQ, AVX2, SSSE3, PCLMULQDQ
+    static const FieldKernel FieldPclmulqdq;    // SSSE3, PCLMULQDQ
+    static const FieldKernel FieldAvx512;       // AVX-512F, batches only
+    static const FieldKernel FieldAvx2;         // AVX2, batches only
+    static const FieldKernel FieldSse2;
+
+    static const Crc32Kernel Crc32Pclmulqdq;    // PCLMULQDQ
+    static const Crc32Kernel Crc32Scalar;
+
+    static const PolynomialKernel PolynomialPclmulqdq;  // PCLMULQDQ
+    static const PolynomialKernel PolynomialScalar;
+
+    [[nodiscard]]
+    static const KernelTable& Get() noexcept;
+};
@@ -0,0 +1,44 @@
+#include <stddef.h>
+#include <stdint.h>
+#include <memory.h>
+#include <memory>
+#include <vector>
+#include <stdexcept>
+#include "Intrinsics.hpp"
+#include "VisualAssistDispatch.hpp"
+
+// Built with AVX2 enabled, see `VisualAssistDispatch` for the unnamed namespace.
+namespace {
+#include "VisualAssistFieldTraits.hpp"
+#include "VisualAssistFieldLanes.hpp"
+
+    struct Avx2FieldKernel {
+        using LaneKernel = VisualAssistFieldLaneKernel<VisualAssistFieldLanesAvx2, VisualAssistFieldTraits>;
+
+        static void MultiplyN(__m128i Results[], const __m128i As[], const __m128i Bs[], size_t Count) noexcept {
+            size_t i = LaneKernel::MultiplyN(Results, As, Bs, Count);
+            VisualAssistDispatch::FieldSse2.MultiplyN(Results + i, As + i, Bs + i, Count - i);
+        }
+
+        static void SquareN(__m128i Results[], const __m128i As[], size_t Count) noexcept {
+            size_t i = LaneKernel::SquareN(Results, As, Count);
+            VisualAssistDispatch::FieldSse2.SquareN(Results + i, As + i, Count - i);
+        }
+
+        static void InverseN(__m128i Results[], const __m128i As[], size_t Count) noexcept {
+            size_t i = LaneKernel::InverseN(Results, As, Count);
+            VisualAssistDispatch::FieldSse2.InverseN(Results + i, As + i, Count - i);
+        }
+    };
+}
+
+// 2 elements at a time by Ning-Yin's algorithm, the rest goes to `FieldSse2`
+const VisualAssistDispatch::FieldKernel VisualAssistDispatch::FieldAvx2 = {
+    "AVX2",
+    nullptr,
+    nullptr,
+    nullptr,
+    Avx2FieldKernel::MultiplyN,
+    Avx2FieldKernel::SquareN,
+    Avx2FieldKernel::InverseN
+};
@@ -0,0 +1,44 @@
+#include <stddef.h>
+#include <stdint.h>
+#include <memory.h>
+#include <memory>
+#include <vector>
+#include <stdexcept>
+#include "Intrinsics.hpp"
+#include "VisualAssistDispatch.hpp"
+
+// Built with AVX-512F enabled, see `VisualAssistDispatch` for the unnamed namespace.
+namespace {
+#include "VisualAssistFieldTraits.hpp"
+#include "VisualAssistFieldLanes.hpp"
+
+    struct Avx512FieldKernel {
+        using LaneKernel = VisualAssistFieldLaneKernel<VisualAssistFieldLanesAvx512, VisualAssistFieldTraits>;
+
+        static void MultiplyN(__m128i Results[], const __m128i As[], const __m128i Bs[], size_t Count) noexcept {
+            size_t i = LaneKernel::MultiplyN(Results, As, Bs, Count);
+            VisualAssistDispatch::FieldAvx2.MultiplyN(Results + i, As + i, Bs + i, Count - i);
+        }
+
+        static void SquareN(__m128i Results[], const __m128i As[], size_t Count) noexcept {
+            size_t i = LaneKernel::SquareN(Results, As, Count);
+            VisualAssistDispatch::FieldAvx2.SquareN(Results + i, As + i, Count - i);
+        }
+
+        static void InverseN(__m128i Results[], const __m128i As[], size_t Count) noexcept {
+            size_t i = LaneKernel::InverseN(Results, As, Count);
+            VisualAssistDispatch::FieldAvx2.InverseN(Results + i, As + i, Count - i);
+        }
+    };
+}
+
+// 4 elements at a time by Ning-Yin's algorithm, the rest goes to `FieldAvx2`
+const VisualAssistDispatch::FieldKernel VisualAssistDispatch::FieldAvx512 = {
+    "AVX-512",
+    nullptr,
+    nullptr,
+    nullptr,
+    Avx512FieldKernel::MultiplyN,
+    Avx512FieldKernel::SquareN,
+    Avx512FieldKernel::InverseN
+};
@@ -0,0 +1,56 @@
+#include <stddef.h>
+#include <stdint.h>
+#include <memory.h>
+#include <memory>
+#include <vector>
+#include <stdexcept>
+#include "Intrinsics.hpp"
+#include "VisualAssistDispatch.hpp"
+
+// Built with SSSE3, PCLMULQDQ, AVX2, VPCLMULQDQ and GFNI enabled, see `VisualAssistDispatch` for the unnamed namespace.
+namespace {
+#include "VisualAssistFieldGfniTraits.hpp"
+
+    struct GfniFieldKernel {
+        using Traits = VisualAssistFieldGfniTraits;
+
+        static void Multiply(__m128i& Result, const __m128i& A, const __m128i& B) noexcept {
+            Traits::Multiply(Result, A, B);
+        }
+
+        static void Prepare(VisualAssistDispatch::FieldPreparedType& Prepared, const __m128i& B) noexcept {
+            Traits::PreparedType PreparedB;
+            Traits::Prepare(PreparedB, B);
+            Prepared.Multiplier = B;
+            Prepared.Palindromic = PreparedB.Palindromic;
+            Prepared.Reversed = PreparedB.Reversed;
+        }
+
+        static void MultiplyPrepared(__m128i& Result, const __m128i& A, const VisualAssistDispatch::FieldPreparedType& B) noexcept {
+            Traits::MultiplyPrepared(Result, A, Traits::PreparedType{ B.Palindromic, B.Reversed });
+        }
+
+        static void MultiplyN(__m128i Results[], const __m128i As[], const __m128i Bs[], size_t Count) noexcept {
+            Traits::MultiplyN(Results, As, Bs, Count);
+        }
+
+        static void SquareN(__m128i Results[], const __m128i As[], size_t Count) noexcept {
+            Traits::SquareN(Results, As, Count);
+        }
+
+        static void InverseN(__m128i Results[], const __m128i As[], size_t Count) noexcept {
+            Traits::InverseN(Results, As, Count);
+        }
+    };
+}
+
+// `VisualAssistFieldGfniTraits`
+const VisualAssistDispatch::FieldKernel VisualAssistDispatch::FieldGfni = {
+    "GFNI",
+    GfniFieldKernel::Multiply,
+    GfniFieldKernel::Prepare,
+    GfniFieldKernel::MultiplyPrepared,
+    GfniFieldKernel::MultiplyN,
+    GfniFieldKernel::SquareN,
+    GfniFieldKernel::InverseN
+};
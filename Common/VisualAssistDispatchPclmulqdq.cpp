@@ -0,0 +1,154 @@
+#include <stddef.h>
+#include <stdint.h>
+#include <memory.h>
+#include <memory>
+#include <vector>
+#include <stdexcept>
+#include "Intrinsics.hpp"
+#include "VisualAssistDispatch.hpp"
+
+// Built with SSSE3 and PCLMULQDQ enabled, see `VisualAssistDispatch` for the unnamed namespace.
+namespace {
+#include "VisualAssistFieldClmulTraits.hpp"
+
+    struct PclmulqdqFieldKernel {
+        using Traits = VisualAssistFieldClmulTraits;
+
+        static void Multiply(__m128i& Result, const __m128i& A, const __m128i& B) noexcept {
+            Traits::Multiply(Result, A, B);
+        }
+
+        static void Prepare(VisualAssistDispatch::FieldPreparedType& Prepared, const __m128i& B) noexcept {
+            Traits::PreparedType PreparedB;
+            Traits::Prepare(PreparedB, B);
+            Prepared.Multiplier = B;
+            Prepared.Palindromic = PreparedB.Palindromic;
+            Prepared.Reversed = PreparedB.Reversed;
+        }
+
+        static void MultiplyPrepared(__m128i& Result, const __m128i& A, const VisualAssistDispatch::FieldPreparedType& B) noexcept {
+            Traits::MultiplyPrepared(Result, A, Traits::PreparedType{ B.Palindromic, B.Reversed });
+        }
+
+        static void MultiplyN(__m128i Results[], const __m128i As[], const __m128i Bs[], size_t Count) noexcept {
+            Traits::MultiplyN(Results, As, Bs, Count);
+        }
+
+        static void SquareN(__m128i Results[], const __m128i As[], size_t Count) noexcept {
+            Traits::SquareN(Results, As, Count);
+        }
+
+        static void InverseN(__m128i Results[], const __m128i As[], size_t Count) noexcept {
+            Traits::InverseN(Results, As, Count);
+        }
+    };
+
+    // Folding by carry-less multiplication, then Barrett reduction.
+    // Gopal et al. Fast CRC Computation for Generic Polynomials Using PCLMULQDQ Instruction.
+    // Constants are those of the bit-reflected form, x^n mod P(x) for the n listed below.
+    struct PclmulqdqCrc32Kernel {
+
+        // Fold a 128-bit value by `K`, then add `Data`.
+        static inline __m128i Fold(const __m128i& A, const __m128i& K, const __m128i& Data) noexcept {
+            return _mm_xor_si128(
+                _mm_xor_si128(_mm_clmulepi64_si128(A, K, 0x00), _mm_clmulepi64_si128(A, K, 0x11)),
+                Data
+            );
+        }
+
+        static uint32_t Update(uint32_t Value, const void* lpData, size_t cbData) noexcept {
+            auto pbData = reinterpret_cast<const uint8_t*>(lpData);
+
+            if (cbData < 64) {
+                return VisualAssistDispatch::Crc32Scalar.Update(Value, pbData, cbData);
+            }
+
+            const __m128i K1K2 = _mm_set_epi64x(0x1c6e41596, 0x154442bd4);    // x^(4*128+32), x^(4*128-32)
+            const __m128i K3K4 = _mm_set_epi64x(0x0ccaa009e, 0x1751997d0);    // x^(128+32),   x^(128-32)
+            const __m128i K5 = _mm_set_epi64x(0, 0x163cd6124);                // x^64
+            const __m128i Poly = _mm_set_epi64x(0x1f7011641, 0x1db710641);    // floor(x^64 / P(x)), P(x)
+            const __m128i Mask32 = _mm_set_epi32(0, 0, 0, -1);
+
+            auto Load = [](const uint8_t* p) noexcept { return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p)); };
+
+            __m128i x1 = _mm_xor_si128(Load(pbData), _mm_cvtsi32_si128(static_cast<int>(Value)));
+            __m128i x2 = Load(pbData + 16);
+            __m128i x3 = Load(pbData + 32);
+            __m128i x4 = Load(pbData + 48);
+            pbData += 64;
+            cbData -= 64;
+
+            for (; cbData >= 64; pbData += 64, cbData -= 64) {
+                x1 = Fold(x1, K1K2, Load(pbData));
+                x2 = Fold(x2, K1K2, Load(pbData + 16));
+                x3 = Fold(x3, K1K2, Load(pbData + 32));
+                x4 = Fold(x4, K1K2, Load(pbData + 48));
+            }
+
+            x1 = Fold(x1, K3K4, x2);
+            x1 = Fold(x1, K3K4, x3);
+            x1 = Fold(x1, K3K4, x4);
+
+            for (; cbData >= 16; pbData += 16, cbData -= 16) {
+                x1 = Fold(x1, K3K4, Load(pbData));
+            }
+
+            // 128 bits -> 96 bits -> 64 bits, each step appends 32 zero bits
+            x1 = _mm_xor_si128(_mm_clmulepi64_si128(x1, K3K4, 0x10), _mm_srli_si128(x1, 8));
+            x1 = _mm_xor_si128(_mm_clmulepi64_si128(_mm_and_si128(x1, Mask32), K5, 0x00), _mm_srli_si128(x1, 4));
+
+            // Barrett reduction, 64 bits -> 32 bits
+            __m128i x2q = _mm_clmulepi64_si128(_mm_and_si128(x1, Mask32), Poly, 0x10);
+            x2q = _mm_clmulepi64_si128(_mm_and_si128(x2q, Mask32), Poly, 0x00);
+            x1 = _mm_xor_si128(x1, x2q);
+
+            Value = static_cast<uint32_t>(_mm_cvtsi128_si32(_mm_srli_si128(x1, 4)));
+
+            return VisualAssistDispatch::Crc32Scalar.Update(Value, pbData, cbData);
+        }
+    };
+
+    // Schoolbook by columns: the A[i] * B[j] with i + j = k are summed first, so each word of `Product` is stored once.
+    struct PclmulqdqPolynomialKernel {
+        static void Multiply(uint64_t Product[], const uint64_t A[], const uint64_t B[], size_t WordCount) noexcept {
+            auto Load = [](const uint64_t* p) noexcept { return _mm_loadl_epi64(reinterpret_cast<const __m128i*>(p)); };
+
+            __m128i Column = _mm_setzero_si128();
+
+            for (size_t k = 0; k + 1 < 2 * WordCount; ++k) {
+                size_t First = k < WordCount ? 0 : k - WordCount + 1;
+                size_t Last = k < WordCount ? k : WordCount - 1;
+
+                Column = _mm_srli_si128(Column, 8);     // high half of the previous column
+                for (size_t i = First; i <= Last; ++i) {
+                    Column = _mm_xor_si128(Column, _mm_clmulepi64_si128(Load(A + i), Load(B + k - i), 0x00));
+                }
+
+                _mm_storel_epi64(reinterpret_cast<__m128i*>(Product + k), Column);
+            }
+
+            _mm_storel_epi64(reinterpret_cast<__m128i*>(Product + 2 * WordCount - 1), _mm_srli_si128(Column, 8));
+        }
+    };
+}
+
+// `VisualAssistFieldClmulTraits`
+const VisualAssistDispatch::FieldKernel VisualAssistDispatch::FieldPclmulqdq = {
+    "PCLMULQDQ",
+    PclmulqdqFieldKernel::Multiply,
+    PclmulqdqFieldKernel::Prepare,
+    PclmulqdqFieldKernel::MultiplyPrepared,
+    PclmulqdqFieldKernel::MultiplyN,
+    PclmulqdqFieldKernel::SquareN,
+    PclmulqdqFieldKernel::InverseN
+};
+
+const VisualAssistDispatch::Crc32Kernel VisualAssistDispatch::Crc32Pclmulqdq = {
+    "PCLMULQDQ",
+    PclmulqdqCrc32Kernel::Update
+};
+
+const VisualAssistDispatch::PolynomialKernel VisualAssistDispatch::PolynomialPclmulqdq = {
+    "PCLMULQDQ",
+    PclmulqdqPolynomialKernel::Multiply
+};
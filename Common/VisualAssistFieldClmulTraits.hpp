@@ -0,0 +1,172 @@
+#pragma once
+#include "VisualAssistFieldTraits.hpp"
+
+// Permutation between type 2 ONB and palindromic basis, see `VisualAssistFieldClmulTraits` below.
+struct VisualAssistPalindromicPermutation {
+    using BlockType = VisualAssistLinearMap::BlockType;
+    using TableType = VisualAssistLinearMap::TableType;
+
+    // Index of beta^(2^i) in palindromic basis.
+    static constexpr size_t PalindromicIndex(size_t i) noexcept {
+        size_t e = 1;
+        for (size_t j = 0; j < i; ++j) {
+            e = e * 2 % (2 * VisualAssistFieldTraits::BinaryBitSizeValue + 1);
+        }
+        return e <= VisualAssistFieldTraits::BinaryBitSizeValue ? e : 2 * VisualAssistFieldTraits::BinaryBitSizeValue + 1 - e;
+    }
+
+    template<bool __ToPalindromic>
+    static constexpr TableType GenerateTable() noexcept {
+        BlockType Images[15 * 8] = {};
+
+        for (size_t i = 0; i < VisualAssistFieldTraits::BinaryBitSizeValue; ++i) {
+            if constexpr (__ToPalindromic) {
+                VisualAssistLinearMap::SetBit(Images[i], PalindromicIndex(i));
+            } else {
+                VisualAssistLinearMap::SetBit(Images[PalindromicIndex(i)], i);
+            }
+        }
+
+        return VisualAssistLinearMap::GenerateTable(Images);
+    }
+};
+
+// GF(2^113) with respect to type 2 ONB, multiplication by PCLMULQDQ.
+// SSSE3 and PCLMULQDQ are required.
+//
+// The type 2 ONB is { beta^(2^i) | 0 <= i < 113 } where beta = gamma + gamma^-1 and `gamma` is a primitive 227-th root of unity.
+// As beta^(2^i) = gamma^e + gamma^-e where e = 2^i mod 227, the ONB is just a permutation of the palindromic basis
+//     { gamma^k + gamma^-k | 1 <= k <= 113 }
+// in which
+//     (gamma^i + gamma^-i) * (gamma^j + gamma^-j) = (gamma^(i + j) + gamma^-(i + j)) + (gamma^(i - j) + gamma^-(i - j))
+// So a product is two carry-less polynomial multiplications followed by a fold modulo x^227 - 1.
+//
+// Reference:
+//     Blake, Roth, Seroussi. Efficient Arithmetic in GF(2^n) through Palindromic Representation.
+struct VisualAssistFieldClmulTraits : VisualAssistFieldTraitsBase<VisualAssistFieldClmulTraits> {
+
+    struct Constant {
+        static constexpr VisualAssistPalindromicPermutation::TableType ToPalindromic =
+            VisualAssistPalindromicPermutation::GenerateTable<true>();
+
+        static constexpr VisualAssistPalindromicPermutation::TableType FromPalindromic =
+            VisualAssistPalindromicPermutation::GenerateTable<false>();
+    };
+
+    static inline __m128i Permute(const VisualAssistPalindromicPermutation::TableType& Table, const ElementType& A) noexcept {
+        return VisualAssistLinearMap::Apply(Table, A);
+    }
+
+    // bit i -> bit 127 - i
+    static inline __m128i BitReverse(const __m128i& A) noexcept {
+        __m128i t = _mm_shuffle_epi8(A, _mm_set_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15));
+        __m128i NibbleReverse = _mm_set_epi8(15, 7, 11, 3, 13, 5, 9, 1, 14, 6, 10, 2, 12, 4, 8, 0);
+
+        __m128i l = _mm_shuffle_epi8(NibbleReverse, _mm_and_si128(t, _mm_set1_epi8(0x0f)));
+        __m128i h = _mm_shuffle_epi8(NibbleReverse, _mm_and_si128(_mm_srli_epi16(t, 4), _mm_set1_epi8(0x0f)));
+
+        return _mm_or_si128(_mm_slli_epi16(l, 4), h);
+    }
+
+    // 0 < __Shift < 64
+    template<int __Shift>
+    static inline __m128i ShiftLeft(const __m128i& A) noexcept {
+        return _mm_or_si128(
+            _mm_slli_epi64(A, __Shift),
+            _mm_srli_epi64(_mm_slli_si128(A, 8), 64 - __Shift)
+        );
+    }
+
+    // 0 < __Shift < 64
+    template<int __Shift>
+    static inline __m128i ShiftRight(const __m128i& A) noexcept {
+        return _mm_or_si128(
+            _mm_srli_epi64(A, __Shift),
+            _mm_slli_epi64(_mm_srli_si128(A, 8), 64 - __Shift)
+        );
+    }
+
+    // (Low, High) = A * B as polynomials over GF(2), Karatsuba
+    static inline void PolynomialMultiply(__m128i& Low, __m128i& High, const __m128i& A, const __m128i& B) noexcept {
+        __m128i l = _mm_clmulepi64_si128(A, B, 0x00);
+        __m128i h = _mm_clmulepi64_si128(A, B, 0x11);
+        __m128i m = _mm_clmulepi64_si128(
+            _mm_xor_si128(A, _mm_srli_si128(A, 8)),
+            _mm_xor_si128(B, _mm_srli_si128(B, 8)),
+            0x00
+        );
+
+        m = _mm_xor_si128(m, _mm_xor_si128(l, h));
+
+        Low = _mm_xor_si128(l, _mm_slli_si128(m, 8));
+        High = _mm_xor_si128(h, _mm_srli_si128(m, 8));
+    }
+
+    // (Low, High) >> 114, only the low 128 bits are kept
+    static inline __m128i ShiftRightBy114(const __m128i& Low, const __m128i& High) noexcept {
+        return _mm_xor_si128(
+            ShiftLeft<14>(High),
+            _mm_srli_epi64(_mm_srli_si128(Low, 8), 50)
+        );
+    }
+
+    // Multiplier in palindromic basis, together with x^114 * B(1 / x) used by `PalindromicMultiply`.
+    struct PreparedType {
+        __m128i Palindromic;
+        __m128i Reversed;
+    };
+
+    static inline void Prepare(PreparedType& Prepared, const ElementType& B) noexcept {
+        Prepared.Palindromic = Permute(Constant::ToPalindromic, B);
+        Prepared.Reversed = ShiftRight<13>(BitReverse(Prepared.Palindromic));
+    }
+
+    // Both operands are in palindromic basis, with coefficient of gamma^k + gamma^-k at bit k.
+    // Let A(x) = sum(a_k * x^k), B(x) = sum(b_k * x^k), P(x) = A(x) * B(x) and R(x) = A(x) * x^114 * B(1 / x), then
+    //     c_k = p_k + p_(227 - k) + r_(114 + k) + r_(114 - k)    where 1 <= k <= 113
+    // The constant term always vanishes, so no fold into the other coefficients is needed.
+    static inline __m128i PalindromicMultiply(const __m128i& A, const PreparedType& B) noexcept {
+        __m128i PLow, PHigh;
+        __m128i RLow, RHigh;
+
+        PolynomialMultiply(PLow, PHigh, A, B.Palindromic);
+        PolynomialMultiply(RLow, RHigh, A, B.Reversed);
+
+        // p_k + r_(114 + k)
+        __m128i Direct = _mm_xor_si128(PLow, ShiftRightBy114(RLow, RHigh));
+
+        // p_(227 - k) + r_(114 - k), gathered in reversed order
+        __m128i Reversed = _mm_xor_si128(
+            ShiftLeft<14>(ShiftRightBy114(PLow, PHigh)),
+            ShiftLeft<13>(RLow)
+        );
+
+        // Bit 0 and bits above 113 are garbage, they are discarded by `FromPalindromic`.
+        return _mm_xor_si128(Direct, BitReverse(Reversed));
+    }
+
+    // Result = A * B
+    static inline void MultiplyPrepared(ElementType& Result, const ElementType& A, const PreparedType& B) noexcept {
+        Result = Permute(
+            Constant::FromPalindromic,
+            PalindromicMultiply(Permute(Constant::ToPalindromic, A), B)
+        );
+    }
+
+    // A *= B
+    static inline void MultiplyPreparedAssign(ElementType& A, const PreparedType& B) noexcept {
+        MultiplyPrepared(A, A, B);
+    }
+
+    // Result = A * B
+    static inline void Multiply(ElementType& Result, const ElementType& A, const ElementType& B) noexcept {
+        PreparedType PreparedB;
+        Prepare(PreparedB, B);
+        MultiplyPrepared(Result, A, PreparedB);
+    }
+
+    // A *= B
+    static inline void MultiplyAssign(ElementType& A, const ElementType& B) noexcept {
+        Multiply(A, A, B);
+    }
+};
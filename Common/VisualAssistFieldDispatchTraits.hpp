@@ -0,0 +1,61 @@
+#pragma once
+#include "VisualAssistFieldTraits.hpp"
+#include "VisualAssistDispatch.hpp"
+
+// GF(2^113) with respect to type 2 ONB, the multiplier is chosen once at runtime:
+//     1. `VisualAssistFieldClmulTraits`    if SSSE3 and PCLMULQDQ are available, with batch multiplications on
+//        `VisualAssistFieldGfniTraits` if GFNI, VPCLMULQDQ and AVX2 are available as well, otherwise
+//     2. `VisualAssistFieldTraits`         which requires SSE2 only, with batches on AVX-512 or AVX2 lanes.
+//     Batch squarings are on AVX-512 or AVX2 lanes whenever these are available.
+// All of them give the same results, so `Inverse`, `Divide` and `SolveQuadratic` are accelerated as well.
+// Kernels live in VisualAssistDispatch*.cpp, so this header needs no instruction set flag.
+struct VisualAssistFieldDispatchTraits : VisualAssistFieldTraitsBase<VisualAssistFieldDispatchTraits> {
+
+    using PreparedType = VisualAssistDispatch::FieldPreparedType;
+
+    // Name of the kernel behind single multiplications, e.g. "PCLMULQDQ"
+    [[nodiscard]]
+    static const char* GetKernelName() noexcept {
+        return VisualAssistDispatch::Get().Field.Name;
+    }
+
+    static inline void Prepare(PreparedType& Prepared, const ElementType& B) noexcept {
+        VisualAssistDispatch::Get().Field.Prepare(Prepared, B);
+    }
+
+    // Result = A * B
+    static inline void MultiplyPrepared(ElementType& Result, const ElementType& A, const PreparedType& B) noexcept {
+        VisualAssistDispatch::Get().Field.MultiplyPrepared(Result, A, B);
+    }
+
+    // A *= B
+    static inline void MultiplyPreparedAssign(ElementType& A, const PreparedType& B) noexcept {
+        MultiplyPrepared(A, A, B);
+    }
+
+    // Result = A * B
+    static inline void Multiply(ElementType& Result, const ElementType& A, const ElementType& B) noexcept {
+        VisualAssistDispatch::Get().Field.Multiply(Result, A, B);
+    }
+
+    // A *= B
+    static inline void MultiplyAssign(ElementType& A, const ElementType& B) noexcept {
+        Multiply(A, A, B);
+    }
+
+    // Results[i] = As[i] * Bs[i]    where 0 <= i < Count
+    static void MultiplyN(ElementType Results[], const ElementType As[], const ElementType Bs[], size_t Count) noexcept {
+        VisualAssistDispatch::Get().Field.MultiplyN(Results, As, Bs, Count);
+    }
+
+    // Results[i] = As[i] ^ 2    where 0 <= i < Count
+    static void SquareN(ElementType Results[], const ElementType As[], size_t Count) noexcept {
+        VisualAssistDispatch::Get().Field.SquareN(Results, As, Count);
+    }
+
+    // Results[i] = As[i] ^ -1    where 0 <= i < Count
+    static void InverseN(ElementType Results[], const ElementType As[], size_t Count) {
+        VisualAssistDispatch::Get().Field.InverseN(Results, As, Count);
+    }
+};
+
@@ -0,0 +1,88 @@
+#pragma once
+#include "VisualAssistFieldClmulTraits.hpp"
+
+// GF(2^113) with respect to type 2 ONB, the same palindromic algorithm as `VisualAssistFieldClmulTraits` but
+//     1. both carry-less products are done together by one 256-bit VPCLMULQDQ per Karatsuba term, and
+//     2. bit reversal is a byte swap plus one GF2P8AFFINEQB, instead of two nibble lookups.
+// SSSE3, PCLMULQDQ, AVX2, VPCLMULQDQ and GFNI are required.
+struct VisualAssistFieldGfniTraits : VisualAssistFieldTraitsBase<VisualAssistFieldGfniTraits> {
+
+    using PreparedType = VisualAssistFieldClmulTraits::PreparedType;
+
+    // bit i -> bit 127 - i
+    static inline __m128i BitReverse(const __m128i& A) noexcept {
+        // row k of the 8 x 8 bit matrix picks bit 7 - k of every byte
+        return _mm_gf2p8affine_epi64_epi8(
+            _mm_shuffle_epi8(A, _mm_set_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15)),
+            _mm_set1_epi64x(static_cast<long long>(0x8040201008040201)),
+            0
+        );
+    }
+
+    static inline void Prepare(PreparedType& Prepared, const ElementType& B) noexcept {
+        Prepared.Palindromic = VisualAssistFieldClmulTraits::Permute(VisualAssistFieldClmulTraits::Constant::ToPalindromic, B);
+        Prepared.Reversed = VisualAssistFieldClmulTraits::ShiftRight<13>(BitReverse(Prepared.Palindromic));
+    }
+
+    // See `VisualAssistFieldClmulTraits::PalindromicMultiply`.
+    // The low lane computes P(x) = A(x) * B(x), the high lane computes R(x) = A(x) * x^114 * B(1 / x).
+    static inline __m128i PalindromicMultiply(const __m128i& A, const PreparedType& B) noexcept {
+        __m256i a = _mm256_broadcastsi128_si256(A);
+        __m256i b = _mm256_inserti128_si256(_mm256_castsi128_si256(B.Palindromic), B.Reversed, 1);
+
+        __m256i l = _mm256_clmulepi64_epi128(a, b, 0x00);
+        __m256i h = _mm256_clmulepi64_epi128(a, b, 0x11);
+        __m256i m = _mm256_clmulepi64_epi128(
+            _mm256_xor_si256(a, _mm256_srli_si256(a, 8)),
+            _mm256_xor_si256(b, _mm256_srli_si256(b, 8)),
+            0x00
+        );
+
+        m = _mm256_xor_si256(m, _mm256_xor_si256(l, h));
+
+        __m256i Low = _mm256_xor_si256(l, _mm256_slli_si256(m, 8));
+        __m256i High = _mm256_xor_si256(h, _mm256_srli_si256(m, 8));
+
+        __m128i PLow = _mm256_castsi256_si128(Low);
+        __m128i PHigh = _mm256_castsi256_si128(High);
+        __m128i RLow = _mm256_extracti128_si256(Low, 1);
+        __m128i RHigh = _mm256_extracti128_si256(High, 1);
+
+        // p_k + r_(114 + k)
+        __m128i Direct = _mm_xor_si128(PLow, VisualAssistFieldClmulTraits::ShiftRightBy114(RLow, RHigh));
+
+        // p_(227 - k) + r_(114 - k), gathered in reversed order
+        __m128i Reversed = _mm_xor_si128(
+            VisualAssistFieldClmulTraits::ShiftLeft<14>(VisualAssistFieldClmulTraits::ShiftRightBy114(PLow, PHigh)),
+            VisualAssistFieldClmulTraits::ShiftLeft<13>(RLow)
+        );
+
+        return _mm_xor_si128(Direct, BitReverse(Reversed));
+    }
+
+    // Result = A * B
+    static inline void MultiplyPrepared(ElementType& Result, const ElementType& A, const PreparedType& B) noexcept {
+        Result = VisualAssistFieldClmulTraits::Permute(
+            VisualAssistFieldClmulTraits::Constant::FromPalindromic,
+            PalindromicMultiply(VisualAssistFieldClmulTraits::Permute(VisualAssistFieldClmulTraits::Constant::ToPalindromic, A), B)
+        );
+    }
+
+    // A *= B
+    static inline void MultiplyPreparedAssign(ElementType& A, const PreparedType& B) noexcept {
+        MultiplyPrepared(A, A, B);
+    }
+
+    // Result = A * B
+    static inline void Multiply(ElementType& Result, const ElementType& A, const ElementType& B) noexcept {
+        PreparedType PreparedB;
+        Prepare(PreparedB, B);
+        MultiplyPrepared(Result, A, PreparedB);
+    }
+
+    // A *= B
+    static inline void MultiplyAssign(ElementType& A, const ElementType& B) noexcept {
+        Multiply(A, A, B);
+    }
+};
+
@@ -0,0 +1,349 @@
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+#include "Intrinsics.hpp"
+
+// A GF(2^113) element takes one 128-bit lane.
+// The vector types below put 1, 2 or 4 independent elements side by side.
+// Every operation stays inside 128-bit lanes, so SSE2 code for one element works for all lanes unchanged.
+// The AVX2 and AVX-512 types exist only where their instruction sets are enabled, as GCC and Clang warn about the ABI
+// of every function returning __m256i or __m512i otherwise. MSVC takes the intrinsics without flags.
+
+struct VisualAssistFieldLanesSse2 {
+    using VectorType = __m128i;
+
+    static constexpr size_t LaneCount = 1;
+
+    static inline VectorType Load(const __m128i* p) noexcept {
+        return _mm_loadu_si128(p);
+    }
+
+    static inline void Store(__m128i* p, const VectorType& A) noexcept {
+        _mm_storeu_si128(p, A);
+    }
+
+    // The same 128-bit pattern in every lane
+    static inline VectorType Broadcast(uint32_t e3, uint32_t e2, uint32_t e1, uint32_t e0) noexcept {
+        return _mm_set_epi32(e3, e2, e1, e0);
+    }
+
+    static inline VectorType And(const VectorType& A, const VectorType& B) noexcept {
+        return _mm_and_si128(A, B);
+    }
+
+    static inline VectorType Or(const VectorType& A, const VectorType& B) noexcept {
+        return _mm_or_si128(A, B);
+    }
+
+    static inline VectorType Xor(const VectorType& A, const VectorType& B) noexcept {
+        return _mm_xor_si128(A, B);
+    }
+
+    template<int __Imm>
+    static inline VectorType Shuffle32(const VectorType& A) noexcept {
+        return _mm_shuffle_epi32(A, __Imm);
+    }
+
+    template<int __Shift>
+    static inline VectorType ShiftLeft32(const VectorType& A) noexcept {
+        return _mm_slli_epi32(A, __Shift);
+    }
+
+    template<int __Shift>
+    static inline VectorType ShiftRight32(const VectorType& A) noexcept {
+        return _mm_srli_epi32(A, __Shift);
+    }
+
+    // Counts of 64 or more give zero.
+    static inline VectorType ShiftLeft64(const VectorType& A, const __m128i& Count) noexcept {
+        return _mm_sll_epi64(A, Count);
+    }
+
+    static inline VectorType ShiftRight64(const VectorType& A, const __m128i& Count) noexcept {
+        return _mm_srl_epi64(A, Count);
+    }
+
+    // Low 64 bits of every lane move to the high 64 bits, and vice versa for `ShiftRightHalf`.
+    static inline VectorType ShiftLeftHalf(const VectorType& A) noexcept {
+        return _mm_slli_si128(A, 8);
+    }
+
+    static inline VectorType ShiftRightHalf(const VectorType& A) noexcept {
+        return _mm_srli_si128(A, 8);
+    }
+};
+
+#if defined(__AVX2__) || defined(_MSC_VER)
+struct VisualAssistFieldLanesAvx2 {
+    using VectorType = __m256i;
+
+    static constexpr size_t LaneCount = 2;
+
+    static inline VectorType Load(const __m128i* p) noexcept {
+        return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+    }
+
+    static inline void Store(__m128i* p, const VectorType& A) noexcept {
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(p), A);
+    }
+
+    static inline VectorType Broadcast(uint32_t e3, uint32_t e2, uint32_t e1, uint32_t e0) noexcept {
+        return _mm256_broadcastsi128_si256(_mm_set_epi32(e3, e2, e1, e0));
+    }
+
+    static inline VectorType And(const VectorType& A, const VectorType& B) noexcept {
+        return _mm256_and_si256(A, B);
+    }
+
+    static inline VectorType Or(const VectorType& A, const VectorType& B) noexcept {
+        return _mm256_or_si256(A, B);
+    }
+
+    static inline VectorType Xor(const VectorType& A, const VectorType& B) noexcept {
+        return _mm256_xor_si256(A, B);
+    }
+
+    template<int __Imm>
+    static inline VectorType Shuffle32(const VectorType& A) noexcept {
+        return _mm256_shuffle_epi32(A, __Imm);
+    }
+
+    template<int __Shift>
+    static inline VectorType ShiftLeft32(const VectorType& A) noexcept {
+        return _mm256_slli_epi32(A, __Shift);
+    }
+
+    template<int __Shift>
+    static inline VectorType ShiftRight32(const VectorType& A) noexcept {
+        return _mm256_srli_epi32(A, __Shift);
+    }
+
+    static inline VectorType ShiftLeft64(const VectorType& A, const __m128i& Count) noexcept {
+        return _mm256_sll_epi64(A, Count);
+    }
+
+    static inline VectorType ShiftRight64(const VectorType& A, const __m128i& Count) noexcept {
+        return _mm256_srl_epi64(A, Count);
+    }
+
+    static inline VectorType ShiftLeftHalf(const VectorType& A) noexcept {
+        return _mm256_slli_si256(A, 8);
+    }
+
+    static inline VectorType ShiftRightHalf(const VectorType& A) noexcept {
+        return _mm256_srli_si256(A, 8);
+    }
+};
+#endif
+
+#if defined(__AVX512F__) || defined(_MSC_VER)
+struct VisualAssistFieldLanesAvx512 {
+    using VectorType = __m512i;
+
+    static constexpr size_t LaneCount = 4;
+
+    static inline VectorType Load(const __m128i* p) noexcept {
+        return _mm512_loadu_si512(p);
+    }
+
+    static inline void Store(__m128i* p, const VectorType& A) noexcept {
+        _mm512_storeu_si512(p, A);
+    }
+
+    static inline VectorType Broadcast(uint32_t e3, uint32_t e2, uint32_t e1, uint32_t e0) noexcept {
+        return _mm512_broadcast_i32x4(_mm_set_epi32(e3, e2, e1, e0));
+    }
+
+    static inline VectorType And(const VectorType& A, const VectorType& B) noexcept {
+        return _mm512_and_si512(A, B);
+    }
+
+    static inline VectorType Or(const VectorType& A, const VectorType& B) noexcept {
+        return _mm512_or_si512(A, B);
+    }
+
+    static inline VectorType Xor(const VectorType& A, const VectorType& B) noexcept {
+        return _mm512_xor_si512(A, B);
+    }
+
+    template<int __Imm>
+    static inline VectorType Shuffle32(const VectorType& A) noexcept {
+        return _mm512_shuffle_epi32(A, static_cast<_MM_PERM_ENUM>(__Imm));
+    }
+
+    template<int __Shift>
+    static inline VectorType ShiftLeft32(const VectorType& A) noexcept {
+        return _mm512_slli_epi32(A, __Shift);
+    }
+
+    template<int __Shift>
+    static inline VectorType ShiftRight32(const VectorType& A) noexcept {
+        return _mm512_srli_epi32(A, __Shift);
+    }
+
+    static inline VectorType ShiftLeft64(const VectorType& A, const __m128i& Count) noexcept {
+        return _mm512_sll_epi64(A, Count);
+    }
+
+    static inline VectorType ShiftRight64(const VectorType& A, const __m128i& Count) noexcept {
+        return _mm512_srl_epi64(A, Count);
+    }
+
+    static inline VectorType ShiftLeftHalf(const VectorType& A) noexcept {
+        return _mm512_unpacklo_epi64(_mm512_setzero_si512(), A);
+    }
+
+    static inline VectorType ShiftRightHalf(const VectorType& A) noexcept {
+        return _mm512_unpackhi_epi64(A, _mm512_setzero_si512());
+    }
+};
+#endif
+
+// GF(2^113) arithmetic on every lane of `__Lanes::VectorType` at once.
+// `__FieldTraits` supplies the multiplication tables `T0` and `T1`.
+template<typename __Lanes, typename __FieldTraits>
+struct VisualAssistFieldLaneKernel {
+    using VectorType = typename __Lanes::VectorType;
+    using ElementType = typename __FieldTraits::ElementType;
+
+    static constexpr size_t LaneCount = __Lanes::LaneCount;
+    static constexpr size_t BinaryBitSizeValue = __FieldTraits::BinaryBitSizeValue;
+
+    static inline VectorType RotateShiftLeftByOne(const VectorType& A) noexcept {
+        VectorType ShiftOut = __Lanes::template Shuffle32<_MM_SHUFFLE(2, 1, 0, 3)>(
+            __Lanes::And(A, __Lanes::Broadcast(0x10000, 0x80000000, 0x80000000, 0x80000000))
+        );
+        VectorType ShiftOutH = __Lanes::template ShiftRight32<31>(ShiftOut);
+        VectorType ShiftOutL = __Lanes::And(
+            __Lanes::template ShiftRight32<16>(ShiftOut),
+            __Lanes::Broadcast(0, 0, 0, 0xffffffff)
+        );
+
+        return __Lanes::And(
+            __Lanes::Xor(
+                __Lanes::Xor(__Lanes::template ShiftLeft32<1>(A), ShiftOutL),
+                ShiftOutH
+            ),
+            __Lanes::Broadcast(0x0001ffff, 0xffffffff, 0xffffffff, 0xffffffff)
+        );
+    }
+
+    static inline VectorType RotateShiftRightByOne(const VectorType& A) noexcept {
+        VectorType ShiftOut = __Lanes::template Shuffle32<_MM_SHUFFLE(0, 3, 2, 1)>(
+            __Lanes::And(A, __Lanes::Broadcast(1, 1, 1, 1))
+        );
+        VectorType ShiftOutH = __Lanes::template ShiftLeft32<16>(
+            __Lanes::And(ShiftOut, __Lanes::Broadcast(0xffffffff, 0, 0, 0))
+        );
+        VectorType ShiftOutL = __Lanes::template ShiftLeft32<31>(
+            __Lanes::And(ShiftOut, __Lanes::Broadcast(0, 0xffffffff, 0xffffffff, 0xffffffff))
+        );
+
+        return __Lanes::Xor(
+            __Lanes::Xor(__Lanes::template ShiftRight32<1>(A), ShiftOutL),
+            ShiftOutH
+        );
+    }
+
+    // Ning-Yin's algorithm, see `VisualAssistFieldTraits::Multiply`
+    static inline VectorType Multiply(const VectorType& A, const VectorType& B) noexcept {
+        VectorType MatrixB[BinaryBitSizeValue];
+
+        MatrixB[0] = B;
+        for (size_t i = 1; i < BinaryBitSizeValue; ++i) {
+            MatrixB[i] = RotateShiftRightByOne(MatrixB[i - 1]);
+        }
+
+        VectorType Result = __Lanes::And(A, MatrixB[__FieldTraits::T0[0]]);
+
+        VectorType Ak = A;
+        for (size_t i = 1; i < BinaryBitSizeValue; ++i) {
+            Ak = RotateShiftRightByOne(Ak);
+            Result = __Lanes::Xor(
+                Result,
+                __Lanes::And(
+                    Ak,
+                    __Lanes::Xor(MatrixB[__FieldTraits::T0[i]], MatrixB[__FieldTraits::T1[i]])
+                )
+            );
+        }
+
+        return Result;
+    }
+
+    // A << k in every lane, see `VisualAssistFieldTraitsBase::ShiftLeft128`
+    static inline VectorType ShiftLeft128(const VectorType& A, size_t k) noexcept {
+        VectorType Low = __Lanes::ShiftLeftHalf(A);
+        return __Lanes::Or(
+            __Lanes::Or(
+                __Lanes::ShiftLeft64(A, _mm_cvtsi32_si128(static_cast<int>(k))),
+                __Lanes::ShiftRight64(Low, _mm_cvtsi32_si128(static_cast<int>(64 - k)))
+            ),
+            __Lanes::ShiftLeft64(Low, _mm_cvtsi32_si128(static_cast<int>(k - 64)))
+        );
+    }
+
+    // A >> k in every lane
+    static inline VectorType ShiftRight128(const VectorType& A, size_t k) noexcept {
+        VectorType High = __Lanes::ShiftRightHalf(A);
+        return __Lanes::Or(
+            __Lanes::Or(
+                __Lanes::ShiftRight64(A, _mm_cvtsi32_si128(static_cast<int>(k))),
+                __Lanes::ShiftLeft64(High, _mm_cvtsi32_si128(static_cast<int>(64 - k)))
+            ),
+            __Lanes::ShiftRight64(High, _mm_cvtsi32_si128(static_cast<int>(k - 64)))
+        );
+    }
+
+    // A ^ (2 ^ k)    where 0 <= k < 113
+    static inline VectorType RotateShiftLeft(const VectorType& A, size_t k) noexcept {
+        return __Lanes::And(
+            __Lanes::Or(ShiftLeft128(A, k), ShiftRight128(A, BinaryBitSizeValue - k)),
+            __Lanes::Broadcast(0x0001ffff, 0xffffffff, 0xffffffff, 0xffffffff)
+        );
+    }
+
+    // The same addition chain as `VisualAssistFieldTraitsBase::Inverse`
+    static inline VectorType Inverse(const VectorType& A) noexcept {
+        VectorType eta = A;
+
+        for (size_t i = 1; i < sizeof(__FieldTraits::InverseAdditionChain); ++i) {
+            size_t k = __FieldTraits::InverseAdditionChain[i - 1];
+
+            if (__FieldTraits::InverseAdditionChain[i] == 2 * k) {
+                eta = Multiply(eta, RotateShiftLeft(eta, k));
+            } else {
+                eta = Multiply(RotateShiftLeftByOne(eta), A);
+            }
+        }
+
+        return RotateShiftLeftByOne(eta);
+    }
+
+    // The following functions process whole vectors only, and return how many elements are done.
+
+    static size_t MultiplyN(ElementType Results[], const ElementType As[], const ElementType Bs[], size_t Count) noexcept {
+        size_t i = 0;
+        for (; i + LaneCount <= Count; i += LaneCount) {
+            __Lanes::Store(&Results[i], Multiply(__Lanes::Load(&As[i]), __Lanes::Load(&Bs[i])));
+        }
+        return i;
+    }
+
+    static size_t SquareN(ElementType Results[], const ElementType As[], size_t Count) noexcept {
+        size_t i = 0;
+        for (; i + LaneCount <= Count; i += LaneCount) {
+            __Lanes::Store(&Results[i], RotateShiftLeftByOne(__Lanes::Load(&As[i])));
+        }
+        return i;
+    }
+
+    static size_t InverseN(ElementType Results[], const ElementType As[], size_t Count) noexcept {
+        size_t i = 0;
+        for (; i + LaneCount <= Count; i += LaneCount) {
+            __Lanes::Store(&Results[i], Inverse(__Lanes::Load(&As[i])));
+        }
+        return i;
+    }
+};
+
@@ -1,13 +1,93 @@
 #pragma once
 #include <stddef.h>
 #include <stdint.h>
-#include <intrin.h>
 #include <memory.h>
+#include <memory>
 #include <vector>
 #include <stdexcept>
+#include "Intrinsics.hpp"
+#include "OnbFieldTraits.hpp"
+
+// Byte-indexed tables of a GF(2)-linear map on 113-bit vectors, where
+//     Entries[i][v] = image of (v << 8 * i)
+// The image of any vector is then the XOR of 15 table entries.
+struct VisualAssistLinearMap {
+    struct alignas(16) BlockType {
+        uint64_t Low;
+        uint64_t High;
+    };
+
+    // The 15 low bytes cover all 113 bits.
+    struct TableType {
+        BlockType Entries[15][256];
+    };
+
+    static constexpr void SetBit(BlockType& Block, size_t i) noexcept {
+        if (i < 64) {
+            Block.Low |= uint64_t{ 1 } << i;
+        } else {
+            Block.High |= uint64_t{ 1 } << (i - 64);
+        }
+    }
+
+    // `Images[i]` is the image of bit i.
+    static constexpr TableType GenerateTable(const BlockType (&Images)[15 * 8]) noexcept {
+        TableType Table = {};
+
+        for (size_t i = 0; i < 15; ++i) {
+            for (size_t v = 1; v < 256; ++v) {
+                size_t LowestBit = 0;
+                while ((v >> LowestBit & 1) == 0) {
+                    ++LowestBit;
+                }
+
+                Table.Entries[i][v].Low = Table.Entries[i][v & (v - 1)].Low ^ Images[8 * i + LowestBit].Low;
+                Table.Entries[i][v].High = Table.Entries[i][v & (v - 1)].High ^ Images[8 * i + LowestBit].High;
+            }
+        }
+
+        return Table;
+    }
+
+    static inline __m128i Apply(const TableType& Table, const __m128i& A) noexcept {
+        alignas(16) uint8_t Bytes[16];
+        _mm_store_si128(reinterpret_cast<__m128i*>(Bytes), A);
+
+        __m128i Result = _mm_load_si128(reinterpret_cast<const __m128i*>(&Table.Entries[0][Bytes[0]]));
+        for (size_t i = 1; i < 15; ++i) {
+            Result = _mm_xor_si128(
+                Result,
+                _mm_load_si128(reinterpret_cast<const __m128i*>(&Table.Entries[i][Bytes[i]]))
+            );
+        }
 
-// GF(2^113) with respect to type 2 ONB 
-struct VisualAssistFieldTraits {
+        return Result;
+    }
+};
+
+// The root z of "z ^ 2 + z = beta" with z_0 = 0, see `VisualAssistFieldTraitsBase::SolveQuadratic`.
+// Squaring is a rotation in ONB, so z_(i - 1) + z_i = beta_i, i.e. z_i = beta_1 + beta_2 + ... + beta_i.
+// This is linear in beta: bit j > 0 of beta goes to bits j ~ 112 of z, and bit 0 is ignored.
+struct VisualAssistQuadraticRoot {
+    static constexpr VisualAssistLinearMap::TableType GenerateTable() noexcept {
+        VisualAssistLinearMap::BlockType Images[15 * 8] = {};
+
+        for (size_t j = 1; j < 113; ++j) {
+            for (size_t i = j; i < 113; ++i) {
+                VisualAssistLinearMap::SetBit(Images[j], i);
+            }
+        }
+
+        return VisualAssistLinearMap::GenerateTable(Images);
+    }
+};
+
+// GF(2^113) with respect to type 2 ONB
+// Everything except multiplication lives here. `__MultiplierTraits` must provide
+// `Multiply`, `MultiplyAssign`, and `PreparedType` with `Prepare`, `MultiplyPrepared` and `MultiplyPreparedAssign`
+// for the case that one multiplier is used many times.
+template<typename __MultiplierTraits>
+struct VisualAssistFieldTraitsBase {
 
     using ElementType = __m128i;
     using TraceType = size_t;
@@ -152,82 +232,12 @@ struct VisualAssistFieldTraits {
         );
     }
 
-    /*
-Generated by the following sage script:
-
-#!/usr/bin/env sage
-
-m = 113                 # GF(2 ^ 113)
-T = 2                   # Type 2 ONB
-P = T * m + 1
-assert(P.is_prime())
-
-F2pTm.<b> = GF(2 ^ (T * m))
-r = F2pTm.primitive_element() ^ ((2 ^ (T * m) - 1) // P)
-l = GF(P).primitive_element() ^ ((P - 1) // 2)
-beta = sum([ r ^ (l ^ i) for i in range(T) ])
-NormalBasis = [ beta ^ (2 ^ i) for i in range(m) ]
-
-NormalBasisToF2pTmMatrix = MatrixSpace(GF(2), m, T * m)([
-    F2pTm.vector_space()(n) for n in NormalBasis
-]).transpose()
-
-MultiplicationTable = MatrixSpace(GF(2), m, m)()
-for i in range(m):
-    for j in range(m):
-        ab = NormalBasis[i] * NormalBasis[j]
-        tt = NormalBasisToF2pTmMatrix.solve_right(F2pTm.vector_space()(ab))
-        MultiplicationTable[i, j] = tt[0]
-    print '%d/%d' % (i, m)
-
-T0 = []
-T1 = []
-for i in range(m):
-    ts = []
-    for j in range(m):
-        if MultiplicationTable[i, j] == 1:
-            ts.append(j)
-    assert(len(ts) == 1 or len(ts) == 2)
-    if len(ts) == 1:
-        T0.append(ts[0])
-        T1.append(0)
-    else:
-        T0.append(ts[0])
-        T1.append(ts[1])
-
-T0 = [ '0x%.2x' % i for i in T0 ]
-T1 = [ '0x%.2x' % i for i in T1 ]
-
-print 'static inline constexpr uint8_t T0[] = {'
-print '    %s' % ', '.join(T0)
-print '};'
-print 'static inline constexpr uint8_t T1[] = {'
-print '    %s' % ', '.join(T1)
-print '};'
-
-        */
-
-    static inline constexpr uint8_t T0[] = {
-        0x01, 0x00, 0x0b, 0x29, 0x39, 0x4a, 0x14, 0x18, 0x2b, 0x5a, 0x28, 0x02, 0x1c, 0x41, 0x12, 0x47,
-        0x4b, 0x24, 0x0e, 0x47, 0x06, 0x18, 0x31, 0x20, 0x07, 0x2b, 0x27, 0x3c, 0x0c, 0x22, 0x25, 0x36,
-        0x17, 0x15, 0x1d, 0x67, 0x11, 0x1e, 0x36, 0x1a, 0x0a, 0x03, 0x39, 0x08, 0x27, 0x0a, 0x01, 0x0b,
-        0x1c, 0x16, 0x52, 0x49, 0x5e, 0x50, 0x1f, 0x1a, 0x3c, 0x04, 0x08, 0x5a, 0x1b, 0x2a, 0x16, 0x20,
-        0x56, 0x0d, 0x4d, 0x44, 0x43, 0x43, 0x4e, 0x0f, 0x06, 0x33, 0x05, 0x10, 0x33, 0x42, 0x44, 0x0f,
-        0x35, 0x1f, 0x17, 0x07, 0x05, 0x14, 0x21, 0x0d, 0x12, 0x60, 0x09, 0x1b, 0x03, 0x41, 0x34, 0x46,
-        0x13, 0x3b, 0x38, 0x04, 0x34, 0x10, 0x24, 0x1e, 0x51, 0x23, 0x11, 0x0e, 0x45, 0x35, 0x26, 0x09,
-        0x2d
-    };
+    // Multiplication tables of type 2 ONB, see `OnbMultiplicationTable`
+    static inline constexpr OnbMultiplicationTable<BinaryBitSizeValue, 2>::TableType MultiplicationTable =
+        OnbMultiplicationTable<BinaryBitSizeValue, 2>::Generate();
 
-    static inline constexpr uint8_t T1[] = {
-        0x00, 0x2e, 0x2e, 0x5c, 0x63, 0x54, 0x48, 0x53, 0x3a, 0x6f, 0x2d, 0x2f, 0x5c, 0x57, 0x6b, 0x4f,
-        0x65, 0x6a, 0x58, 0x60, 0x55, 0x21, 0x3e, 0x52, 0x15, 0x3e, 0x37, 0x5b, 0x30, 0x57, 0x67, 0x51,
-        0x3f, 0x56, 0x31, 0x69, 0x66, 0x58, 0x6e, 0x2c, 0x5b, 0x2f, 0x3d, 0x19, 0x6f, 0x70, 0x02, 0x29,
-        0x3d, 0x22, 0x69, 0x4c, 0x64, 0x6d, 0x26, 0x3f, 0x62, 0x2a, 0x54, 0x61, 0x38, 0x30, 0x19, 0x37,
-        0x62, 0x5d, 0x6b, 0x45, 0x4e, 0x6c, 0x5f, 0x13, 0x4b, 0x53, 0x64, 0x48, 0x6a, 0x5e, 0x46, 0x6c,
-        0x65, 0x68, 0x32, 0x49, 0x3a, 0x61, 0x40, 0x1d, 0x25, 0x6e, 0x3b, 0x28, 0x0c, 0x63, 0x4d, 0x6d,
-        0x59, 0x55, 0x40, 0x5d, 0x4a, 0x50, 0x68, 0x23, 0x66, 0x32, 0x4c, 0x42, 0x4f, 0x5f, 0x59, 0x2c,
-        0x70
-    };
+    static inline constexpr const uint16_t (&T0)[BinaryBitSizeValue] = MultiplicationTable.T0;
+    static inline constexpr const uint16_t (&T1)[BinaryBitSizeValue] = MultiplicationTable.T1;
 
     static inline void RotateShiftLeftByOne(ElementType& Result, const ElementType& A) noexcept {
         __m128i ShiftOut = _mm_shuffle_epi32(
@@ -352,93 +362,93 @@ print '};'
         );
     }
 
-    // Result = A * B
-    // https://www.princeton.edu/~rblee/ELE572Papers/Fall04Readings/NingYin-FiniteFieldMul.pdf
-    static inline void Multiply(ElementType& Result, const ElementType& A, const ElementType& B) noexcept {
-        ElementType MatrixB[BinaryBitSizeValue];
-
-        MatrixB[0] = B;
-        for (size_t i = 1; i < BinaryBitSizeValue; ++i) {
-            RotateShiftRightByOne(MatrixB[i], MatrixB[i - 1]);
-        }
-
-        Result = _mm_and_si128(A, MatrixB[T0[0]]);
-
-        ElementType Ak = A;
-        for (size_t i = 1; i < BinaryBitSizeValue; ++i) {
-            RotateShiftRightByOneAssign(Ak);
-            Result = _mm_xor_si128(
-                Result,
-                _mm_and_si128(
-                    Ak,
-                    _mm_xor_si128(MatrixB[T0[i]], MatrixB[T1[i]])
-                )
-            );
-        }
+    // Result = A << k    where 0 <= k < 128
+    // Counts of 64 or more give zero with `_mm_sll_epi64`, so both halves are computed without branches.
+    static inline __m128i ShiftLeft128(const __m128i& A, size_t k) noexcept {
+        __m128i Low = _mm_slli_si128(A, 8);
+        return _mm_or_si128(
+            _mm_or_si128(
+                _mm_sll_epi64(A, _mm_cvtsi32_si128(static_cast<int>(k))),
+                _mm_srl_epi64(Low, _mm_cvtsi32_si128(static_cast<int>(64 - k)))
+            ),
+            _mm_sll_epi64(Low, _mm_cvtsi32_si128(static_cast<int>(k - 64)))
+        );
     }
 
-    // A *= B
-    // https://www.princeton.edu/~rblee/ELE572Papers/Fall04Readings/NingYin-FiniteFieldMul.pdf
-    static inline void MultiplyAssign(ElementType& A, const ElementType& B) noexcept {
-        ElementType MatrixB[BinaryBitSizeValue];
+    // Result = A >> k    where 0 <= k < 128
+    static inline __m128i ShiftRight128(const __m128i& A, size_t k) noexcept {
+        __m128i High = _mm_srli_si128(A, 8);
+        return _mm_or_si128(
+            _mm_or_si128(
+                _mm_srl_epi64(A, _mm_cvtsi32_si128(static_cast<int>(k))),
+                _mm_sll_epi64(High, _mm_cvtsi32_si128(static_cast<int>(64 - k)))
+            ),
+            _mm_srl_epi64(High, _mm_cvtsi32_si128(static_cast<int>(k - 64)))
+        );
+    }
 
-        MatrixB[0] = B;
-        for (size_t i = 1; i < BinaryBitSizeValue; ++i) {
-            RotateShiftRightByOne(MatrixB[i], MatrixB[i - 1]);
-        }
+    // Result = A ^ (2 ^ k)    where 0 <= k < 113
+    // Shift counts are taken from registers, so the time does not depend on `k`.
+    static inline void RotateShiftLeft(ElementType& Result, const ElementType& A, size_t k) noexcept {
+        Result = _mm_and_si128(
+            _mm_or_si128(ShiftLeft128(A, k), ShiftRight128(A, BinaryBitSizeValue - k)),
+            _mm_set_epi32(0x0001ffff, 0xffffffff, 0xffffffff, 0xffffffff)
+        );
+    }
 
-        ElementType Ak = A;
+    static inline void RotateShiftLeftAssign(ElementType& A, size_t k) noexcept {
+        RotateShiftLeft(A, A, k);
+    }
 
-        A = _mm_and_si128(A, MatrixB[T0[0]]);
+    // Result = A ^ (2 ^ -k)    where 0 <= k < 113
+    static inline void RotateShiftRight(ElementType& Result, const ElementType& A, size_t k) noexcept {
+        Result = _mm_and_si128(
+            _mm_or_si128(ShiftRight128(A, k), ShiftLeft128(A, BinaryBitSizeValue - k)),
+            _mm_set_epi32(0x0001ffff, 0xffffffff, 0xffffffff, 0xffffffff)
+        );
+    }
 
-        for (size_t i = 1; i < BinaryBitSizeValue; ++i) {
-            RotateShiftRightByOneAssign(Ak);
-            A = _mm_xor_si128(
-                A,
-                _mm_and_si128(
-                    Ak,
-                    _mm_xor_si128(MatrixB[T0[i]], MatrixB[T1[i]])
-                )
-            );
-        }
+    static inline void RotateShiftRightAssign(ElementType& A, size_t k) noexcept {
+        RotateShiftRight(A, A, k);
     }
 
     static inline void Divide(ElementType& Result, const ElementType& A, const ElementType& B) {
         ElementType InverseOfB;
         Inverse(InverseOfB, B);
-        Multiply(Result, A, InverseOfB);
+        __MultiplierTraits::Multiply(Result, A, InverseOfB);
     }
 
     static inline void DivideAssign(ElementType& A, const ElementType& B) {
         ElementType InverseOfB;
         Inverse(InverseOfB, B);
-        MultiplyAssign(A, InverseOfB);
+        __MultiplierTraits::MultiplyAssign(A, InverseOfB);
     }
 
+    // Shortest addition chain of 113 - 1, every step either doubles the previous one or adds 1 to it.
+    static inline constexpr uint8_t InverseAdditionChain[] = { 1, 2, 3, 6, 7, 14, 28, 56, 112 };
+
     // Result = A ^ -1
-    // IEEE P1363/D9. Standard Specifications for Public Key Cryptography
-    // Annex A (informative)
-    // Number-Theoretic Background.
-    // Page. 100
+    // Itoh-Tsujii: A ^ -1 = (A ^ (2 ^ 112 - 1)) ^ 2. Let beta_k = A ^ (2 ^ k - 1), then
+    //     beta_(i + j) = beta_i ^ (2 ^ j) * beta_j
+    // so beta_112 costs one multiplication and one rotation per step of `InverseAdditionChain`.
+    //
+    // Itoh, Tsujii. A Fast Algorithm for Computing Multiplicative Inverses in GF(2^m) Using Normal Bases.
     static inline void Inverse(ElementType& Result, const ElementType& A) {
-        const uint8_t bs[] = { 0, 0, 0, 0, 1, 1, 1 };   // bits of (113 - 1)
-        ElementType eta = A;
-        size_t k = 1;
+        ElementType eta = A;    // beta_k
 
-        for (int i = 6 - 1; i >= 0; --i) {
-            ElementType mu = eta;
-
-            for (size_t j = 1; j <= k; ++j) {
-                SquareAssign(mu);
-            }
+        typename __MultiplierTraits::PreparedType PreparedA;
+        __MultiplierTraits::Prepare(PreparedA, A);
 
-            MultiplyAssign(eta, mu);    // original document has a typo, it should be "eta <- mu * eta"
-            k *= 2;
+        for (size_t i = 1; i < sizeof(InverseAdditionChain); ++i) {
+            size_t k = InverseAdditionChain[i - 1];
 
-            if (bs[i]) {
+            if (InverseAdditionChain[i] == 2 * k) {
+                ElementType mu;
+                RotateShiftLeft(mu, eta, k);
+                __MultiplierTraits::MultiplyAssign(eta, mu);                // beta_2k = beta_k ^ (2 ^ k) * beta_k
+            } else {
                 SquareAssign(eta);
-                MultiplyAssign(eta, A);
-                ++k;
+                __MultiplierTraits::MultiplyPreparedAssign(eta, PreparedA);  // beta_(k + 1) = beta_k ^ 2 * beta_1
             }
         }
 
@@ -470,6 +480,83 @@ print '};'
         RotateShiftRightByOneAssign(A);
     }
 
+    // Results[i] = As[i] * Bs[i]    where 0 <= i < Count
+    static void MultiplyN(ElementType Results[], const ElementType As[], const ElementType Bs[], size_t Count) noexcept {
+        for (size_t i = 0; i < Count; ++i) {
+            __MultiplierTraits::Multiply(Results[i], As[i], Bs[i]);
+        }
+    }
+
+    // Results[i] = As[i] ^ 2    where 0 <= i < Count
+    static void SquareN(ElementType Results[], const ElementType As[], size_t Count) noexcept {
+        for (size_t i = 0; i < Count; ++i) {
+            Square(Results[i], As[i]);
+        }
+    }
+
+    // Results[i] = As[i] ^ -1    where 0 <= i < Count
+    static void InverseN(ElementType Results[], const ElementType As[], size_t Count) {
+        for (size_t i = 0; i < Count; ++i) {
+            Inverse(Results[i], As[i]);
+        }
+    }
+
+    // Batches up to this size take no heap allocation in `BatchInverse`.
+    static constexpr size_t BatchInverseStackCount = 64;
+
+    // Results[i] = As[i] ^ -1    where 0 <= i < Count, `Results` may be the same array as `As`
+    // Montgomery's trick: with prefix products P_i = As[0] * ... * As[i],
+    //     As[i] ^ -1 = P_(i - 1) * P_i ^ -1    and    P_(i - 1) ^ -1 = As[i] * P_i ^ -1
+    // so only P_(Count - 1) is inverted, at the cost of 3 * (Count - 1) multiplications.
+    // Zero elements are taken as one in the products, and stay zero in `Results`.
+    static void BatchInverse(ElementType Results[], const ElementType As[], size_t Count) {
+        if (Count == 0) {
+            return;
+        }
+
+        ElementType One;
+        SetOne(One);
+
+        // The prefix products of small batches, e.g. the tables of a scalar multiplication, stay on the stack.
+        // Larger ones go to the heap, which is little next to their 3 * (Count - 1) multiplications.
+        // __m128i is wrapped as it loses its attributes as a template argument.
+        struct PrefixType {
+            ElementType Value;
+        };
+
+        PrefixType StackPrefixes[BatchInverseStackCount];
+        std::unique_ptr<PrefixType[]> HeapPrefixes(Count > BatchInverseStackCount ? new PrefixType[Count] : nullptr);
+        PrefixType* Prefixes = HeapPrefixes ? HeapPrefixes.get() : StackPrefixes;
+
+        Prefixes[0].Value = IsZero(As[0]) ? One : As[0];
+        for (size_t i = 1; i < Count; ++i) {
+            if (IsZero(As[i])) {
+                Prefixes[i].Value = Prefixes[i - 1].Value;
+            } else {
+                __MultiplierTraits::Multiply(Prefixes[i].Value, Prefixes[i - 1].Value, As[i]);
+            }
+        }
+
+        ElementType InversePrefix;  // P_i ^ -1
+        Inverse(InversePrefix, Prefixes[Count - 1].Value);
+
+        for (size_t i = Count - 1; i > 0; --i) {
+            if (IsZero(As[i])) {
+                SetZero(Results[i]);
+            } else {
+                ElementType a = As[i];
+                __MultiplierTraits::Multiply(Results[i], Prefixes[i - 1].Value, InversePrefix);
+                __MultiplierTraits::MultiplyAssign(InversePrefix, a);
+            }
+        }
+
+        if (IsZero(As[0])) {
+            SetZero(Results[0]);
+        } else {
+            Results[0] = InversePrefix;
+        }
+    }
+
     // Result = tr(A)
     static inline void Trace(TraceType& Result, const ElementType& A) {
         __m128i v = _mm_sub_epi32(
@@ -527,7 +614,9 @@ print '};'
         ) % 2u;
     }
 
-    // Find a `z` which satisfies `z^2 + z = Beta`
+    static inline constexpr VisualAssistLinearMap::TableType QuadraticRootTable = VisualAssistQuadraticRoot::GenerateTable();
+
+    // Find a `z` which satisfies `z^2 + z = Beta`, the other one is `z + 1`
     [[nodiscard]]
     static inline bool SolveQuadratic(ElementType& Element, const ElementType& Beta) {
         TraceType tr;
@@ -536,39 +625,15 @@ print '};'
         if (tr == 1) {
             return false;
         } else {
-            uint32_t root[4] = {};
-            uint32_t beta[4] = {};
-            static_cast<void>(
-                Serialize(Beta, beta, sizeof(beta))
-            );
-
-            uint32_t* proot = root;
-            uint32_t* pbeta = beta;
-            uint32_t mask = 0x2;
-            for (size_t i = 1; i < 113; ++i) {
-                if (mask != 1) {
-                    proot[0] |= ((proot[0] & (mask >> 1)) << 1) ^ (pbeta[0] & mask);
-                } else {
-                    proot[0] |= _rotl((proot[-1] & _rotr(mask, 1)), 1) ^ (pbeta[0] & mask);
-                }
-
-                mask <<= 1;
-                if (mask == 0) {
-                    mask = 1;
-                    ++proot;
-                    ++pbeta;
-                }
-            }
-
-            Element = _mm_set_epi32(root[3], root[2], root[1], root[0]);
-
+            Element = VisualAssistLinearMap::Apply(QuadraticRootTable, Beta);
             return true;
         }
     }
 
     // Find root `x`s which satisfies `A * x ^ 2 + B * x + C = 0`
+    // Roots are written to `Roots`, and the number of roots, 0, 1 or 2, is returned.
     [[nodiscard]]
-    static inline std::vector<ElementType> SolveQuadratic(const ElementType& A, const ElementType& B, const ElementType& C) {
+    static inline size_t SolveQuadratic(ElementType (&Roots)[2], const ElementType& A, const ElementType& B, const ElementType& C) {
         if (IsZero(A)) {
             throw std::invalid_argument("A cannot be zero.");
         }
@@ -576,35 +641,132 @@ print '};'
         if (IsZero(B)) {
             // A * x ^ 2 + C = 0
             //  x = sqrt(C / A)
-            ElementType Root;
-
-            Divide(Root, C, A);
-            SquareRootAssign(Root);
+            Divide(Roots[0], C, A);
+            SquareRootAssign(Roots[0]);
 
-            return std::vector<ElementType>{ Root };
+            return 1;
         } else {
+            // Substitute x = z * B / A, then z ^ 2 + z = A * C / B ^ 2.
+            // Both A * C / B ^ 2 and B / A come from the single inversion of A * B ^ 2.
+            ElementType BB;
+            ElementType InverseOfABB;
             ElementType beta;
-            ElementType x1;
-            ElementType x2;
-
-            Inverse(beta, B);           // beta = 1 / B
-            SquareAssign(beta);         // beta = 1 / B^2
-            MultiplyAssign(beta, A);    // beta = A / B^2
-            MultiplyAssign(beta, C);    // beta = A * C / B^2
-            
-            if (SolveQuadratic(x1, beta)) {
-                AddOne(x2, x1);
-
-                MultiplyAssign(x1, B);
-                DivideAssign(x1, A);
-                MultiplyAssign(x2, B);
-                DivideAssign(x2, A);
-
-                return std::vector<ElementType>{x1, x2};
+            ElementType BOverA;
+
+            Square(BB, B);
+            __MultiplierTraits::Multiply(InverseOfABB, A, BB);
+            InverseAssign(InverseOfABB);
+
+            __MultiplierTraits::Multiply(beta, A, C);
+            __MultiplierTraits::MultiplyAssign(beta, A);
+            __MultiplierTraits::MultiplyAssign(beta, InverseOfABB);    // beta = A ^ 2 * C / (A * B ^ 2)
+
+            __MultiplierTraits::Multiply(BOverA, BB, B);
+            __MultiplierTraits::MultiplyAssign(BOverA, InverseOfABB);  // B / A = B ^ 3 / (A * B ^ 2)
+
+            if (SolveQuadratic(Roots[0], beta)) {
+                // x1 = z * B / A, x2 = (z + 1) * B / A = x1 + B / A
+                __MultiplierTraits::MultiplyAssign(Roots[0], BOverA);
+                Add(Roots[1], Roots[0], BOverA);
+
+                return 2;
             } else {
-                return std::vector<ElementType>();
+                return 0;
             }
         }
     }
 };
 
+// Multiplication by Ning-Yin's algorithm, only SSE2 is required.
+struct VisualAssistFieldTraits : VisualAssistFieldTraitsBase<VisualAssistFieldTraits> {
+
+    // Result = A * B
+    // https://www.princeton.edu/~rblee/ELE572Papers/Fall04Readings/NingYin-FiniteFieldMul.pdf
+    static inline void Multiply(ElementType& Result, const ElementType& A, const ElementType& B) noexcept {
+        ElementType MatrixB[BinaryBitSizeValue];
+
+        MatrixB[0] = B;
+        for (size_t i = 1; i < BinaryBitSizeValue; ++i) {
+            RotateShiftRightByOne(MatrixB[i], MatrixB[i - 1]);
+        }
+
+        Result = _mm_and_si128(A, MatrixB[T0[0]]);
+
+        ElementType Ak = A;
+        for (size_t i = 1; i < BinaryBitSizeValue; ++i) {
+            RotateShiftRightByOneAssign(Ak);
+            Result = _mm_xor_si128(
+                Result,
+                _mm_and_si128(
+                    Ak,
+                    _mm_xor_si128(MatrixB[T0[i]], MatrixB[T1[i]])
+                )
+            );
+        }
+    }
+
+    // A *= B
+    // https://www.princeton.edu/~rblee/ELE572Papers/Fall04Readings/NingYin-FiniteFieldMul.pdf
+    static inline void MultiplyAssign(ElementType& A, const ElementType& B) noexcept {
+        ElementType MatrixB[BinaryBitSizeValue];
+
+        MatrixB[0] = B;
+        for (size_t i = 1; i < BinaryBitSizeValue; ++i) {
+            RotateShiftRightByOne(MatrixB[i], MatrixB[i - 1]);
+        }
+
+        ElementType Ak = A;
+
+        A = _mm_and_si128(A, MatrixB[T0[0]]);
+
+        for (size_t i = 1; i < BinaryBitSizeValue; ++i) {
+            RotateShiftRightByOneAssign(Ak);
+            A = _mm_xor_si128(
+                A,
+                _mm_and_si128(
+                    Ak,
+                    _mm_xor_si128(MatrixB[T0[i]], MatrixB[T1[i]])
+                )
+            );
+        }
+    }
+
+    // Rotated copies of the multiplier, already combined by `T0` and `T1`.
+    struct PreparedType {
+        ElementType MatrixB[BinaryBitSizeValue];
+    };
+
+    static inline void Prepare(PreparedType& Prepared, const ElementType& B) noexcept {
+        ElementType MatrixB[BinaryBitSizeValue];
+
+        MatrixB[0] = B;
+        for (size_t i = 1; i < BinaryBitSizeValue; ++i) {
+            RotateShiftRightByOne(MatrixB[i], MatrixB[i - 1]);
+        }
+
+        Prepared.MatrixB[0] = MatrixB[T0[0]];
+        for (size_t i = 1; i < BinaryBitSizeValue; ++i) {
+            Prepared.MatrixB[i] = _mm_xor_si128(MatrixB[T0[i]], MatrixB[T1[i]]);
+        }
+    }
+
+    // Result = A * B
+    static inline void MultiplyPrepared(ElementType& Result, const ElementType& A, const PreparedType& B) noexcept {
+        ElementType Ak = A;
+
+        Result = _mm_and_si128(A, B.MatrixB[0]);
+
+        for (size_t i = 1; i < BinaryBitSizeValue; ++i) {
+            RotateShiftRightByOneAssign(Ak);
+            Result = _mm_xor_si128(
+                Result,
+                _mm_and_si128(Ak, B.MatrixB[i])
+            );
+        }
+    }
+
+    // A *= B
+    static inline void MultiplyPreparedAssign(ElementType& A, const PreparedType& B) noexcept {
+        MultiplyPrepared(A, A, B);
+    }
+};
@@ -0,0 +1,106 @@
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+#include <stdexcept>
+#include <atomic>
+#include <memory>
+
+// Chunks 0 to ChunkCount - 1 dealt out to ThreadCount threads in contiguous ranges, one range a thread.
+// A thread takes chunks from the front of its own range, and once that runs dry, steals the back half of the largest range left.
+// A range is packed into one atomic as begin | end << 32, so that both ends move by compare-and-swap without locks.
+// Begins only grow and ends only shrink, except when a thief refills its own empty range with chunks no other range ever had,
+// so a range never comes back to a value it had before.
+class WorkStealingQueue {
+private:
+
+    struct alignas(64) Range {
+        std::atomic<uint64_t> Value;
+    };
+
+    std::unique_ptr<Range[]> m_Ranges;
+    size_t m_ThreadCount;
+
+    [[nodiscard]]
+    static uint64_t Pack(uint64_t Begin, uint64_t End) noexcept {
+        return Begin | End << 32;
+    }
+
+    [[nodiscard]]
+    static uint64_t GetBegin(uint64_t Value) noexcept {
+        return Value & 0xffffffff;
+    }
+
+    [[nodiscard]]
+    static uint64_t GetEnd(uint64_t Value) noexcept {
+        return Value >> 32;
+    }
+
+    [[nodiscard]]
+    static bool TakeFront(Range& R, size_t& Chunk) noexcept {
+        uint64_t Value = R.Value.load();
+
+        while (GetBegin(Value) < GetEnd(Value)) {
+            if (R.Value.compare_exchange_weak(Value, Pack(GetBegin(Value) + 1, GetEnd(Value)))) {
+                Chunk = static_cast<size_t>(GetBegin(Value));
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+public:
+
+    WorkStealingQueue(size_t ChunkCount, size_t ThreadCount) :
+        m_Ranges(new Range[ThreadCount]),
+        m_ThreadCount(ThreadCount)
+    {
+        if (ThreadCount == 0) {
+            throw std::invalid_argument("ThreadCount cannot be zero.");
+        }
+
+        if (ChunkCount > 0xffffffff) {
+            throw std::invalid_argument("Too many chunks.");
+        }
+
+        for (size_t t = 0; t < ThreadCount; ++t) {
+            m_Ranges[t].Value.store(Pack(ChunkCount * t / ThreadCount, ChunkCount * (t + 1) / ThreadCount));
+        }
+    }
+
+    // The next chunk for thread t, or false if there is none left.
+    [[nodiscard]]
+    bool Pop(size_t t, size_t& Chunk) noexcept {
+        if (TakeFront(m_Ranges[t], Chunk)) {
+            return true;
+        }
+
+        while (true) {
+            size_t Victim = m_ThreadCount;
+            uint64_t VictimValue = 0;
+
+            for (size_t v = 0; v < m_ThreadCount; ++v) {
+                uint64_t Value = m_Ranges[v].Value.load();
+                if (v != t && GetEnd(Value) - GetBegin(Value) > GetEnd(VictimValue) - GetBegin(VictimValue)) {
+                    Victim = v;
+                    VictimValue = Value;
+                }
+            }
+
+            if (Victim == m_ThreadCount) {
+                return false;
+            }
+
+            // The victim keeps [Begin, Middle), the thief takes Middle and keeps (Middle, End).
+            uint64_t Begin = GetBegin(VictimValue);
+            uint64_t End = GetEnd(VictimValue);
+            uint64_t Middle = End - (End - Begin + 1) / 2;
+
+            if (m_Ranges[Victim].Value.compare_exchange_strong(VictimValue, Pack(Begin, Middle))) {
+                m_Ranges[t].Value.store(Pack(Middle + 1, End));
+                Chunk = static_cast<size_t>(Middle);
+                return true;
+            }
+        }
+    }
+};
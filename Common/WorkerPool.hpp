@@ -0,0 +1,136 @@
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+#include <algorithm>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+// Threads kept for the life of the pool, which run one job at a time as t = 0, 1, ..., ThreadCount - 1.
+// The caller runs t = 0 itself, and a thread is started only the first time a job needs more than the pool has.
+// While a job is running, any other one, e.g. one started from inside it, is run by its caller alone, t after t.
+// A job should therefore take its work from something like `WorkStealingQueue`, and never wait for another t.
+class WorkerPool {
+private:
+
+    std::mutex m_RunMutex;                  // held by the caller whose job the threads run
+    std::mutex m_Mutex;                     // guards everything below
+    std::condition_variable m_JobReady;
+    std::condition_variable m_JobDone;
+    std::vector<std::thread> m_Threads;     // m_Threads[i] runs t = i + 1
+
+    void (*m_Job)(void* lpContext, size_t t) noexcept;
+    void* m_Context;
+    size_t m_JobThreadCount;                // threads t = 1 to m_JobThreadCount take part in the current job
+    size_t m_PendingCount;
+    uint64_t m_Generation;                  // bumped for every job
+    bool m_IsStopping;
+
+    void WorkerMain(size_t t, uint64_t Generation) noexcept {
+        std::unique_lock<std::mutex> Lock(m_Mutex);
+
+        while (true) {
+            m_JobReady.wait(Lock, [this, Generation] { return m_IsStopping || m_Generation != Generation; });
+
+            if (m_IsStopping) {
+                return;
+            }
+
+            Generation = m_Generation;
+
+            if (t <= m_JobThreadCount) {
+                auto Job = m_Job;
+                auto Context = m_Context;
+
+                Lock.unlock();
+                Job(Context, t);
+                Lock.lock();
+
+                if (--m_PendingCount == 0) {
+                    m_JobDone.notify_one();
+                }
+            }
+        }
+    }
+
+public:
+
+    WorkerPool() noexcept :
+        m_Job(nullptr),
+        m_Context(nullptr),
+        m_JobThreadCount(0),
+        m_PendingCount(0),
+        m_Generation(0),
+        m_IsStopping(false) {}
+
+    WorkerPool(const WorkerPool&) = delete;
+    WorkerPool& operator=(const WorkerPool&) = delete;
+
+    ~WorkerPool() {
+        {
+            std::lock_guard<std::mutex> Lock(m_Mutex);
+            m_IsStopping = true;
+        }
+
+        m_JobReady.notify_all();
+
+        for (auto& Thread : m_Threads) {
+            Thread.join();
+        }
+    }
+
+    // The pool shared by the whole process
+    [[nodiscard]]
+    static WorkerPool& Get() noexcept {
+        static WorkerPool Pool;
+        return Pool;
+    }
+
+    // Job(t) for every 0 <= t < ThreadCount, returning when all of them have. Job must not throw.
+    template<typename __JobType>
+    void Run(size_t ThreadCount, __JobType&& Job) {
+        ThreadCount = std::max<size_t>(ThreadCount, 1);
+
+        std::unique_lock<std::mutex> RunLock(m_RunMutex, std::try_to_lock);
+
+        if (ThreadCount == 1 || RunLock.owns_lock() == false) {
+            for (size_t t = 0; t < ThreadCount; ++t) {
+                Job(t);
+            }
+            return;
+        }
+
+        {
+            std::lock_guard<std::mutex> Lock(m_Mutex);
+
+            while (m_Threads.size() < ThreadCount - 1) {
+                m_Threads.emplace_back(&WorkerPool::WorkerMain, this, m_Threads.size() + 1, m_Generation);
+            }
+
+            m_Job = [](void* lpContext, size_t t) noexcept {
+                (*static_cast<std::remove_reference_t<__JobType>*>(lpContext))(t);
+            };
+            m_Context = const_cast<void*>(static_cast<const void*>(std::addressof(Job)));
+            m_JobThreadCount = ThreadCount - 1;
+            m_PendingCount = ThreadCount - 1;
+            ++m_Generation;
+        }
+
+        m_JobReady.notify_all();
+
+        Job(0);
+
+        std::unique_lock<std::mutex> Lock(m_Mutex);
+        m_JobDone.wait(Lock, [this] { return m_PendingCount == 0; });
+    }
+
+    // Threads started so far, besides the callers'
+    [[nodiscard]]
+    size_t GetThreadCount() noexcept {
+        std::lock_guard<std::mutex> Lock(m_Mutex);
+        return m_Threads.size();
+    }
+};
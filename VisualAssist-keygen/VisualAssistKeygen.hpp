@@ -4,6 +4,7 @@
 #include <bcrypt.h>
 
 #include <BigInteger.hpp>
+#include <FixedUInt.hpp>
 #include <Hasher.hpp>
 #include <HasherMd5Traits.hpp>
 #include <HasherCrc32Traits.hpp>
@@ -23,18 +24,21 @@ template<typename __ConfigType, size_t __Idx>
 class VisualAssistKeygen {
 private:
 
-    static inline const auto& Order         = __ConfigType::Order;
+    using ScalarType = typename __ConfigType::ScalarType;
+
+    static inline const auto& Curve         = __ConfigType::Curve;
+    static inline const auto& Order         = __ConfigType::ScalarOrder;
     static inline const auto& Sym           = __ConfigType::Custom::Sym[__Idx];
     static inline const auto& G             = __ConfigType::Custom::G[__Idx];
     static inline const auto& PrivateKey    = __ConfigType::Custom::PrivateKey[__Idx];
     static inline const auto& PublicKey     = __ConfigType::Custom::PublicKey[__Idx];
 
     struct ECCSignature {
-        BigInteger r;
-        BigInteger s;
+        ScalarType r;
+        ScalarType s;
     };
 
-    static BigInteger GenerateHashInteger(const void* lpMessage, size_t cbMessage) {
+    static ScalarType GenerateHashInteger(const void* lpMessage, size_t cbMessage) {
         uint32_t RawHash[4];
         Hasher Md5(HasherMd5Traits::InitByDefault{});
 
@@ -44,10 +48,10 @@ private:
         std::swap(RawHash[0], RawHash[3]);
         std::swap(RawHash[1], RawHash[2]);
 
-        return BigInteger(false, RawHash, sizeof(RawHash), BigIntegerEndian::Little);
+        return ScalarType(false, RawHash, sizeof(RawHash), BigIntegerEndian::Little);
     }
 
-    static BigInteger GenerateRandom() {
+    static ScalarType GenerateRandom() {
         uint8_t RawRandom[32];
 
         auto ntStatus = BCryptGenRandom(NULL, RawRandom, sizeof(RawRandom), BCRYPT_USE_SYSTEM_PREFERRED_RNG);
@@ -55,7 +59,7 @@ private:
             throw std::system_error(RtlNtStatusToDosError(ntStatus), std::system_category());
         }
 
-        BigInteger Random(false, RawRandom, sizeof(RawRandom), BigIntegerEndian::Little);
+        ScalarType Random(false, RawRandom, sizeof(RawRandom), BigIntegerEndian::Little);
         Random %= Order;
 
         return Random;
@@ -64,7 +68,7 @@ private:
     static ECCSignature Sign(const void* lpMessage, size_t cbMessage) {
         ECCSignature Signature;
         while (true) {
-            BigInteger Rnd = GenerateRandom();
+            ScalarType Rnd = GenerateRandom();
             auto R = G * Rnd;
 
             Signature.r.Load(false, R.GetX().Serialize(), BigIntegerEndian::Little);
@@ -73,8 +77,10 @@ private:
                 continue;
             }
 
-            BigInteger h = GenerateHashInteger(lpMessage, cbMessage);
+            // r, d, h and k ^ -1 are below 2 ^ 128, so that every product fits before it is reduced.
+            ScalarType h = GenerateHashInteger(lpMessage, cbMessage);
             Signature.s = h + Signature.r * PrivateKey;
+            Signature.s %= Order;
             Signature.s *= Rnd.InverseModValue(Order);
             Signature.s %= Order;
             if (Signature.s.IsZero()) {
@@ -86,11 +92,11 @@ private:
     }
 
     static bool Verify(const void* lpMessage, size_t cbMessage, const ECCSignature& Signature) {
-        if (Signature.r < 1 || Order <= Signature.r) {
+        if (Signature.r.IsZero() || Order <= Signature.r) {
             return false;
         }
 
-        if (Signature.s < 1 || Order <= Signature.s) {
+        if (Signature.s.IsZero() || Order <= Signature.s) {
             return false;
         }
 
@@ -101,12 +107,13 @@ private:
         u1 %= Order;
         u2 %= Order;
 
-        auto R = G * u1 + PublicKey * u2;
+        // both terms share one chain of doublings, or of Frobenius maps on a Koblitz curve
+        auto R = Curve.MultiScalarMul({ G, PublicKey }, { u1, u2 });
         if (R.IsAtInfinity()) {
             return false;
         }
 
-        BigInteger RxInteger(false, R.GetX().Dump(), true);
+        ScalarType RxInteger(false, R.GetX().Serialize(), BigIntegerEndian::Little);
         RxInteger %= Order;
 
         return RxInteger == Signature.r;
@@ -0,0 +1,19 @@
+#include "BitslicedBench.hpp"
+#include <BitslicedVisualAssistField.hpp>
+#include <ProcessorFeatures.hpp>
+
+// BitslicedVisualAssistField on every lane width the processor has, i.e. 128, 256 and 512 elements per batch.
+
+int main() {
+    RunBitslicedBench<BitslicedVisualAssistField<VisualAssistFieldLanesSse2>, VisualAssistFieldTraits>("SSE2");
+
+    if (ProcessorFeatures::HasAvx2()) {
+        RunBitslicedBenchAvx2();
+    }
+
+    if (ProcessorFeatures::HasAvx512F()) {
+        RunBitslicedBenchAvx512();
+    }
+
+    return 0;
+}
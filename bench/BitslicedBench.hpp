@@ -0,0 +1,61 @@
+#pragma once
+#include <stdio.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <algorithm>
+#include <chrono>
+#include <random>
+#include "Intrinsics.hpp"
+
+// Throughput of one bit-sliced batch multiplication against the scalar Ning-Yin `Multiply`, in ns per element, best of 5 runs.
+// __BitslicedType and __FieldTraits are passed in, as every file below has its own copy of them built for its instruction set.
+template<typename __BitslicedType, typename __FieldTraits>
+void RunBitslicedBench(const char* lpszName) {
+    constexpr size_t BatchSize = __BitslicedType::BatchSizeValue;
+
+    static __m128i As[BatchSize], Bs[BatchSize], Results[BatchSize];
+
+    std::mt19937_64 Random(113);
+    for (size_t i = 0; i < BatchSize; ++i) {
+        As[i] = _mm_set_epi64x(static_cast<int64_t>(Random() & 0x1ffffffffffff), static_cast<int64_t>(Random()));
+        Bs[i] = _mm_set_epi64x(static_cast<int64_t>(Random() & 0x1ffffffffffff), static_cast<int64_t>(Random()));
+    }
+
+    __BitslicedType A(As, BatchSize);
+    __BitslicedType B(Bs, BatchSize);
+
+    auto Measure = [](auto&& Function) {
+        double Best = 1e30;
+
+        for (int i = 0; i < 5; ++i) {
+            auto Start = std::chrono::steady_clock::now();
+            Function();
+            Best = std::min(Best, std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - Start).count() / BatchSize);
+        }
+
+        return Best;
+    };
+
+    double Bitsliced = Measure([&A, &B] {
+        auto Product = A * B;
+        Product.Store(Results, 1);
+    });
+
+    double Transposes = Measure([] {
+        __BitslicedType Batch(As, BatchSize);
+        Batch.Store(Results, BatchSize);
+    });
+
+    double Scalar = Measure([] {
+        for (size_t i = 0; i < BatchSize; ++i) {
+            __FieldTraits::Multiply(Results[i], As[i], Bs[i]);
+        }
+    });
+
+    printf("%-8s %3zu elements  bit-sliced Multiply %6.1f  Load + Store %6.1f  scalar Multiply %6.1f ns/element\n",
+           lpszName, BatchSize, Bitsliced, Transposes, Scalar);
+}
+
+// Built with AVX2 and AVX-512F enabled respectively
+void RunBitslicedBenchAvx2();
+void RunBitslicedBenchAvx512();
@@ -0,0 +1,17 @@
+#include <stddef.h>
+#include <stdint.h>
+#include <memory.h>
+#include <memory>
+#include <vector>
+#include <stdexcept>
+#include "Intrinsics.hpp"
+#include "BitslicedBench.hpp"
+
+// Built with AVX2 enabled, inside an unnamed namespace as the kernels of VisualAssistDispatch are.
+namespace {
+#include <BitslicedVisualAssistField.hpp>
+}
+
+void RunBitslicedBenchAvx2() {
+    RunBitslicedBench<BitslicedVisualAssistField<VisualAssistFieldLanesAvx2>, VisualAssistFieldTraits>("AVX2");
+}
@@ -0,0 +1,17 @@
+#include <stddef.h>
+#include <stdint.h>
+#include <memory.h>
+#include <memory>
+#include <vector>
+#include <stdexcept>
+#include "Intrinsics.hpp"
+#include "BitslicedBench.hpp"
+
+// Built with AVX-512 enabled, inside an unnamed namespace as the kernels of VisualAssistDispatch are.
+namespace {
+#include <BitslicedVisualAssistField.hpp>
+}
+
+void RunBitslicedBenchAvx512() {
+    RunBitslicedBench<BitslicedVisualAssistField<VisualAssistFieldLanesAvx512>, VisualAssistFieldTraits>("AVX-512");
+}
@@ -0,0 +1,61 @@
+#include <stdio.h>
+#include <stdint.h>
+#include <algorithm>
+#include <chrono>
+#include <random>
+#include <vector>
+#include <BigInteger.hpp>
+#include <FixedBasePrecomp.hpp>
+#include <SecBinaryCurves.hpp>
+#include <VisualAssistCryptoConfig.hpp>
+
+// Memory/latency trade-off of FixedBasePrecomp for memory limits from 1 KB to 1 MB, against operator* with no table.
+// k * G is timed over 300 random k < n, best of 2 runs.
+
+static std::mt19937_64 Random(113);
+
+template<typename __CurveType>
+static void Run(const char* lpszCurveName, const typename __CurveType::Point& G, const BigInteger& Order) {
+    std::vector<BigInteger> Scalars;
+    for (size_t i = 0; i < 300; ++i) {
+        std::vector<uint8_t> Bytes((Order.BitLength() + 7) / 8);
+        for (auto& Byte : Bytes) {
+            Byte = static_cast<uint8_t>(Random());
+        }
+        Scalars.emplace_back(BigInteger(false, Bytes, BigIntegerEndian::Little) % Order);
+    }
+
+    auto Measure = [&Scalars](auto&& Multiply) {
+        double Best = 1e30;
+
+        for (int i = 0; i < 2; ++i) {
+            auto Start = std::chrono::steady_clock::now();
+            for (const auto& K : Scalars) {
+                static_cast<void>(Multiply(K));
+            }
+            Best = std::min(Best, std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - Start).count() / Scalars.size());
+        }
+
+        return Best;
+    };
+
+    printf("%s, operator* with no table: %.1f us\n", lpszCurveName, Measure([&G](const BigInteger& K) { return G * K; }));
+    printf("  limit     w    v  doublings     bytes     build    k * G\n");
+
+    for (size_t MemoryLimit : { size_t{1} << 10, size_t{1} << 12, size_t{1} << 14, size_t{1} << 16, size_t{1} << 18, size_t{1} << 20 }) {
+        auto Start = std::chrono::steady_clock::now();
+        FixedBasePrecomp<__CurveType> Precomp(G, Order, MemoryLimit);
+        double Build = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - Start).count();
+
+        double Latency = Measure([&Precomp](const BigInteger& K) { return Precomp * K; });
+
+        printf("  %4zu KB  %3u  %3zu  %9zu  %8zu  %6.2f ms  %5.1f us\n",
+               MemoryLimit >> 10, Precomp.GetWidth(), Precomp.GetBlockCount(), Precomp.GetDoublingCount(), Precomp.GetMemorySize(), Build, Latency);
+    }
+}
+
+int main() {
+    Run<decltype(VisualAssistCryptoConfig::Curve)>("VA curve", VisualAssistCryptoConfig::Custom::G[0], VisualAssistCryptoConfig::Order);
+    Run<decltype(SecBinaryCurves::Sect233k1::Curve)>("sect233k1", SecBinaryCurves::Sect233k1::G, SecBinaryCurves::Sect233k1::Order);
+    return 0;
+}
@@ -0,0 +1,76 @@
+#include <stdio.h>
+#include <string.h>
+#include <algorithm>
+#include <string>
+#include <Hasher.hpp>
+#include <HasherMd5Traits.hpp>
+#include <VisualAssistCryptoConfig.hpp>
+
+// MD5 known answers, from RFC 1321 A.5 and from VisualAssistCryptoConfig::Official.
+
+static std::string ToHex(const uint8_t* lpBytes, size_t cbBytes) {
+    static const char Digits[] = "0123456789abcdef";
+    std::string Result;
+    for (size_t i = 0; i < cbBytes; ++i) {
+        Result.append(1, Digits[lpBytes[i] >> 4]).append(1, Digits[lpBytes[i] & 0xf]);
+    }
+    return Result;
+}
+
+int main() {
+    static const char* const Vectors[][2] = {
+        { "", "d41d8cd98f00b204e9800998ecf8427e" },
+        { "a", "0cc175b9c0f1b6a831c399e269772661" },
+        { "abc", "900150983cd24fb0d6963f7d28e17f72" },
+        { "message digest", "f96b697d7cb7938d525a2f31aaf161d0" },
+        { "abcdefghijklmnopqrstuvwxyz", "c3fcd3d76192e4007dfb496cca67e13b" },
+        { "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789", "d174ab98d277d9f5a5611c2c9f419d9f" },
+        { "12345678901234567890123456789012345678901234567890123456789012345678901234567890", "57edf4a22be3c955ac49da2e2107b67a" }
+    };
+
+    int Failures = 0;
+
+    for (const auto& Vector : Vectors) {
+        const char* Message = Vector[0];
+        size_t Length = strlen(Message);
+
+        // Once at an odd address in one call, and once a byte at a time, to reach both paths of Update.
+        std::string Unaligned = std::string(1, ' ') + Message;
+
+        Hasher Whole(HasherMd5Traits::InitByDefault{});
+        Whole.Update(Unaligned.data() + 1, Length);
+
+        Hasher Bytewise(HasherMd5Traits::InitByDefault{});
+        for (size_t i = 0; i < Length; ++i) {
+            Bytewise.Update(Message + i, 1);
+        }
+
+        for (const auto& Digest : { Whole.Evaluate(), Bytewise.Evaluate() }) {
+            auto Hex = ToHex(Digest.data(), Digest.size());
+            if (Hex != Vector[1]) {
+                printf("MD5(\"%s\") = %s, expected %s\n", Message, Hex.c_str(), Vector[1]);
+                ++Failures;
+            }
+        }
+    }
+
+    // The same as VisualAssistCryptoConfig::GeneratePublicKeyStringMd5
+    for (size_t i = 0; i < 2; ++i) {
+        auto s = VisualAssistCryptoConfig::Official::PublicKeyString[i];
+        std::reverse(s.begin(), s.end());
+
+        Hasher Md5(HasherMd5Traits::InitByDefault{});
+        Md5.Update(s.data(), s.length());
+
+        uint32_t Md5Digest[4];
+        Md5.Evaluate(Md5Digest);
+
+        uint32_t Value = Md5Digest[0] ^ Md5Digest[1] ^ Md5Digest[2] ^ Md5Digest[3];
+        if (Value != VisualAssistCryptoConfig::Official::PublicKeyStringMd5[i]) {
+            printf("PublicKeyStringMd5[%zu] = 0x%08X, expected 0x%08X\n", i, Value, VisualAssistCryptoConfig::Official::PublicKeyStringMd5[i]);
+            ++Failures;
+        }
+    }
+
+    return Failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,76 @@
+#include <stdio.h>
+#include <stdint.h>
+#include <random>
+#include <BigInteger.hpp>
+#include <EllipticCurveGF2m.hpp>
+#include <SecBinaryCurves.hpp>
+#include <VisualAssistCryptoConfig.hpp>
+
+// Every scalar multiplication strategy against DoubleAndAdd, for positive and negative scalars.
+
+static std::mt19937_64 Random(113);
+
+static BigInteger RandomScalar(size_t Bits, bool IsNegative) {
+    uint8_t Bytes[64] = {};
+    for (size_t i = 0; i < (Bits + 7) / 8; ++i) {
+        Bytes[i] = static_cast<uint8_t>(Random());
+    }
+    if (Bits % 8) {
+        Bytes[Bits / 8] &= static_cast<uint8_t>((1u << Bits % 8) - 1);
+    }
+    return BigInteger(IsNegative, Bytes, (Bits + 7) / 8, BigIntegerEndian::Little);
+}
+
+static const struct {
+    ScalarMulStrategy Value;
+    const char* lpszName;
+} Strategies[] = {
+    { ScalarMulStrategy::MontgomeryLadder, "MontgomeryLadder" },
+    { ScalarMulStrategy::TauAdicNaf, "TauAdicNaf" },
+    { ScalarMulStrategy::WindowNaf, "WindowNaf" },
+    { ScalarMulStrategy::HalveAndAdd, "HalveAndAdd" }
+};
+
+template<typename __PointType>
+static int Check(const char* lpszCurveName, const __PointType& G, const BigInteger& Order) {
+    int Failures = 0;
+
+    // Scalars below n, then up to 2^16 * n
+    for (size_t i = 0; i < 40; ++i) {
+        BigInteger K = RandomScalar(Order.BitLength() + (i < 30 ? 0 : 16), i % 2 != 0);
+
+        auto Expected = G.Multiply(K, ScalarMulStrategy::DoubleAndAdd);
+        auto Negated = G.Multiply(-K, ScalarMulStrategy::DoubleAndAdd);
+
+        if (Expected != -Negated || (Expected + Negated).IsAtInfinity() == false) {
+            printf("%s: DoubleAndAdd(-k) != -DoubleAndAdd(k) for k = %s\n", lpszCurveName, K.ToString(16).c_str());
+            ++Failures;
+        }
+
+        for (const auto& Strategy : Strategies) {
+            if (G.Multiply(K, Strategy.Value) != Expected) {
+                printf("%s: %s(k) != DoubleAndAdd(k) for k = %s\n", lpszCurveName, Strategy.lpszName, K.ToString(16).c_str());
+                ++Failures;
+            }
+        }
+    }
+
+    return Failures;
+}
+
+int main() {
+    int Failures = 0;
+
+    Failures += Check("VisualAssist", VisualAssistCryptoConfig::Official::G[0], VisualAssistCryptoConfig::Order);
+
+    // G + (0, 1) has order 2n, i.e. lies outside the subgroup of order n.
+    using FieldType = GaloisField<VisualAssistFieldDispatchTraits>;
+    auto T = VisualAssistCryptoConfig::Curve.CreatePoint(FieldType{ GaloisFieldInitByZero{} }, FieldType{ GaloisFieldInitByOne{} });
+    Failures += Check("VisualAssist, order 2n", VisualAssistCryptoConfig::Official::G[0] + T, VisualAssistCryptoConfig::Order);
+    Failures += Check("VisualAssist, order 2", T, VisualAssistCryptoConfig::Order);
+
+    Failures += Check("sect163k1", SecBinaryCurves::Sect163k1::G, SecBinaryCurves::Sect163k1::Order);
+    Failures += Check("sect233k1", SecBinaryCurves::Sect233k1::G, SecBinaryCurves::Sect233k1::Order);
+
+    return Failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,81 @@
+#include <stdio.h>
+#include <string>
+#include <vector>
+#include <BigInteger.hpp>
+#include <SecBinaryCurves.hpp>
+
+// SEC 2: Recommended Elliptic Curve Domain Parameters, version 2.0
+//     3.2 Recommended Parameters over F_2^m
+// The base points in compressed form, and n * G = O.
+
+static std::string ToHex(const std::vector<uint8_t>& Bytes) {
+    static const char Digits[] = "0123456789ABCDEF";
+    std::string Result;
+    for (auto Byte : Bytes) {
+        Result.append(1, Digits[Byte >> 4]).append(1, Digits[Byte & 0xf]);
+    }
+    return Result;
+}
+
+template<typename __CurveParameters>
+static int Check(const char* lpszCurveName, const char* lpszCompressedG) {
+    const auto& G = __CurveParameters::G;
+    const auto& n = __CurveParameters::Order;
+    int Failures = 0;
+
+    auto Hex = ToHex(G.DumpCompressed());
+    if (Hex != lpszCompressedG) {
+        printf("%s: G = %s, expected %s\n", lpszCurveName, Hex.c_str(), lpszCompressedG);
+        ++Failures;
+    }
+
+    std::vector<uint8_t> Encoding(Hex.length() / 2);
+    for (size_t i = 0; i < Encoding.size(); ++i) {
+        Encoding[i] = static_cast<uint8_t>(std::stoul(std::string(lpszCompressedG + 2 * i, 2), nullptr, 16));
+    }
+
+    auto Decoded = __CurveParameters::Curve.CreateInfinityPoint();
+    Decoded.LoadCompressed(Encoding.data(), Encoding.size());
+    if (Decoded != G) {
+        printf("%s: the compressed G doesn't decode to G\n", lpszCurveName);
+        ++Failures;
+    }
+
+    if ((G * n).IsAtInfinity() == false) {
+        printf("%s: n * G != O\n", lpszCurveName);
+        ++Failures;
+    }
+
+    if (G * (n - 1) != -G) {
+        printf("%s: (n - 1) * G != -G\n", lpszCurveName);
+        ++Failures;
+    }
+
+    return Failures;
+}
+
+int main() {
+    int Failures = 0;
+
+    Failures += Check<SecBinaryCurves::Sect163k1>(
+        "sect163k1",
+        "0302FE13C0537BBC11ACAA07D793DE4E6D5E5C94EEE8"
+    );
+
+    Failures += Check<SecBinaryCurves::Sect233k1>(
+        "sect233k1",
+        "02017232BA853A7E731AF129F22FF4149563A419C26BF50A4C9D6EEFAD6126"
+    );
+
+    Failures += Check<SecBinaryCurves::Sect283k1>(
+        "sect283k1",
+        "020503213F78CA44883F1A3B8162F188E553CD265F23C1567A16876913B0C2AC2458492836"
+    );
+
+    Failures += Check<SecBinaryCurves::Sect409k1>(
+        "sect409k1",
+        "030060F05F658F49C1AD3AB1890F7184210EFD0987E307C84C27ACCFB8F9F67CC2C460189EB5AAAA62EE222EB1B35540CFE9023746"
+    );
+
+    return Failures == 0 ? 0 : 1;
+}